@@ -40,8 +40,4 @@ class AnimatorViewModel: ObservableObject {
     var isAlive: Bool {
         SPTAnimator.exists(id: animatorId)
     }
-    
-    func resetAnimator() {
-        SPTAnimator.reset(id: _animator.id)
-    }
 }
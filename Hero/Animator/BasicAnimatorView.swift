@@ -55,8 +55,6 @@ struct BasicAnimatorView<RC, OV>: View where RC: Component, OV: View {
             VStack(spacing: 0.0) {
                 SignalGraphView(restartFlag: $model.restartFlag) { samplingRate, time in
                     model.getValueItem(samplingRate: samplingRate, time: time)
-                } onStart: {
-                    model.resetAnimator()
                 }
                 .padding()
                 .layoutPriority(1)
@@ -154,7 +154,6 @@ struct OscillatorAnimatorView_Previews: PreviewProvider {
     
     static var previews: some View {
         let id = SPTAnimator.make(.init(name: "Oscillator.1", source: .init(oscillatorWithFrequency: 1.0, interpolation: .smoothStep)))
-        SPTAnimator.reset(id: id)
         return ContentView(animatorId: id)
     }
     
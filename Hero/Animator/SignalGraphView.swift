@@ -142,7 +142,7 @@ struct SignalGraphView: View {
     static let samplingRate = UIScreen.main.maximumFramesPerSecond
     static let lineWidth: CGFloat = 1.5
     
-    init(restartFlag: Binding<Bool> = .constant(false), signal: @escaping (Int, TimeInterval) -> SignalValueItem?, onStart: @escaping () -> Void) {
+    init(restartFlag: Binding<Bool> = .constant(false), signal: @escaping (Int, TimeInterval) -> SignalValueItem?, onStart: @escaping () -> Void = {}) {
         _restartFlag = restartFlag
         self.signal = signal
         self.onStart = onStart
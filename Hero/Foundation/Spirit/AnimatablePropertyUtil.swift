@@ -38,6 +38,8 @@ extension SPTAnimatableObjectProperty: Displayable {
             return "Y"
         case .eulerOrientationZ:
             return "Z"
+        case .quaternionOrientationAngle:
+            return "Angle"
         case .xyzScaleX:
             return "X"
         case .xyzScaleY:
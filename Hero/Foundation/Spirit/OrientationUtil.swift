@@ -40,6 +40,8 @@ extension SPTOrientationModel: CaseIterable, Identifiable, Displayable {
             fatalError()
         case .zxAxis:
             fatalError()
+        case .quaternion:
+            return "Quaternion"
         }
     }
     
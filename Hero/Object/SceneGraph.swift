@@ -85,6 +85,20 @@ class SceneGraph: ObservableObject {
         
     }
     
+    func setParent(_ parent: SPTObject?, objects: [SPTObject]) {
+        let parentEntity = parent?.entity ?? kSPTNullEntity
+        let movedObjects = objects.filter { SPTTransformationGetNode($0).parent != parentEntity }
+        let movedRootObjects = Set(movedObjects.filter { SPTTransformationGetNode($0).parent == kSPTNullEntity })
+        
+        SPTTransformationSetParentBatch(movedObjects, movedObjects.count, parentEntity)
+        if parent != nil {
+            rootObjects.removeAll { movedRootObjects.contains($0) }
+        } else {
+            rootObjects.append(contentsOf: movedObjects)
+        }
+        
+    }
+    
     func makeRandomMeshes(lookCategories: LookCategories) {
         let positionRange: ClosedRange<Float> = -500.0...500.0
         let scaleRange: ClosedRange<Float> = 10.0...40.0
@@ -17,10 +17,6 @@ class PlayViewModel: ObservableObject {
         self.scene = scene
         self.viewCameraEntity = viewCameraEntity
     }
-    
-    func resetAnimators() {
-        SPTAnimator.resetAll()
-    }
 }
 
 
@@ -51,9 +47,6 @@ struct PlayView: View {
                 dragValue = nil
             }
         }
-        .onAppear {
-            model.resetAnimators()
-        }
     }
     
     func dragGesture(geometry: GeometryProxy, bottomSafeAreaInset: CGFloat) -> some Gesture {
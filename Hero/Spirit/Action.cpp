@@ -7,7 +7,9 @@
 
 #include "Action.h"
 #include "Scene.hpp"
-#include "Orientation.h"
+#include "Orientation.hpp"
+
+#include <vector>
 
 namespace spt {
 
@@ -20,11 +22,68 @@ struct Action {
     SPTEasingType easing;
 };
 
+// Arc is precomputed on creation so that tweening needs no 'acos'
+struct QuaternionOrientationAction {
+    Orientation::QuaternionSlerp slerp;
+    double duration;
+    double startTime;
+    SPTEasingType easing;
+};
+
+// Tweens are evaluated in a gather pass, a weight kernel over parallel arrays and a scatter pass
+void updateQuaternionOrientationActions(Registry& registry, double time) {
+    
+    auto view = registry.view<QuaternionOrientationAction>();
+    if(view.empty()) {
+        return;
+    }
+    
+    const auto count = view.size();
+    std::vector<float> progresses;
+    std::vector<float> angles;
+    std::vector<float> inverseSinAngles;
+    std::vector<SPTEntity> finishedEntities;
+    progresses.reserve(count);
+    angles.reserve(count);
+    inverseSinAngles.reserve(count);
+    
+    view.each([time, &progresses, &angles, &inverseSinAngles, &finishedEntities] (SPTEntity entity, const QuaternionOrientationAction& action) {
+        const auto passed = time - action.startTime;
+        if (passed >= action.duration) {
+            progresses.push_back(1.f);
+            finishedEntities.push_back(entity);
+        } else {
+            progresses.push_back(SPTEasingEvaluate(action.easing, passed / action.duration));
+        }
+        angles.push_back(action.slerp.angle);
+        inverseSinAngles.push_back(action.slerp.inverseSinAngle);
+    });
+    
+    std::vector<float> fromWeights (count);
+    std::vector<float> toWeights (count);
+    Orientation::evaluateQuaternionSlerpWeights(progresses.data(), angles.data(), inverseSinAngles.data(), fromWeights.data(), toWeights.data(), count);
+    
+    // Same iteration order as the gather pass
+    std::size_t i = 0;
+    view.each([&registry, &fromWeights, &toWeights, &i] (SPTEntity entity, const QuaternionOrientationAction& action) {
+        
+        spt::Transformation::markDirty(registry, entity);
+        
+        auto& orientation = registry.get<SPTOrientation>(entity);
+        assert(orientation.model == SPTOrientationModelQuaternion);
+        
+        orientation.quaternion = simd_normalize(simd_quaternion(fromWeights[i] * action.slerp.from.vector + toWeights[i] * action.slerp.to.vector));
+        ++i;
+    });
+    
+    registry.erase<QuaternionOrientationAction>(finishedEntities.begin(), finishedEntities.end());
+}
+
 void updateActions(Registry& registry, double time) {
     
     registry.view<Action<SPTPosition>>().each([&registry, time] (SPTEntity entity, const Action<SPTPosition>& action) {
         
-        spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, entity);
+        spt::Transformation::markDirty(registry, entity);
         
         const auto passed = time - action.startTime;
         if (passed >= action.duration) {
@@ -39,7 +98,7 @@ void updateActions(Registry& registry, double time) {
     
     registry.view<Action<SPTOrientation>>().each([&registry, time] (SPTEntity entity, const Action<SPTOrientation>& action) {
         
-        spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, entity);
+        spt::Transformation::markDirty(registry, entity);
         
         auto& orientation = registry.get<SPTOrientation>(entity);
         assert(orientation.model == SPTOrientationModelLookAtPoint);
@@ -55,6 +114,8 @@ void updateActions(Registry& registry, double time) {
         
     });
     
+    updateQuaternionOrientationActions(registry, time);
+    
 }
 
 }
@@ -86,13 +147,25 @@ void SPTOrientationActionMakeLookAtTarget(SPTObject object, simd_float3 target,
     auto delta = startOrientation;
     delta.lookAtPoint.target = target - startOrientation.lookAtPoint.target;
     
+    scene.registry.remove<spt::QuaternionOrientationAction>(object.entity);
     scene.registry.emplace_or_replace<spt::Action<SPTOrientation>>(object.entity, spt::Action<SPTOrientation>{startOrientation, delta, duration, scene.time(), easing});
 }
 
+void SPTOrientationActionMakeQuaternion(SPTObject object, simd_quatf quaternion, double duration, SPTEasingType easing) {
+    auto& scene = *static_cast<spt::Scene*>(object.sceneHandle);
+    const auto& startOrientation = scene.registry.get<SPTOrientation>(object.entity);
+    assert(startOrientation.model == SPTOrientationModelQuaternion);
+    
+    scene.registry.remove<spt::Action<SPTOrientation>>(object.entity);
+    scene.registry.emplace_or_replace<spt::QuaternionOrientationAction>(object.entity, spt::QuaternionOrientationAction{spt::Orientation::makeQuaternionSlerp(startOrientation.quaternion, quaternion), duration, scene.time(), easing});
+}
+
 bool SPTOrientationActionExists(SPTObject object) {
-    return spt::Scene::getRegistry(object).all_of<spt::Action<SPTOrientation>>(object.entity);
+    return spt::Scene::getRegistry(object).any_of<spt::Action<SPTOrientation>, spt::QuaternionOrientationAction>(object.entity);
 }
 
 void SPTOrientationActionDestroy(SPTObject object) {
-    spt::Scene::getRegistry(object).erase<spt::Action<SPTOrientation>>(object.entity);
+    auto& registry = spt::Scene::getRegistry(object);
+    assert((registry.any_of<spt::Action<SPTOrientation>, spt::QuaternionOrientationAction>(object.entity)));
+    registry.remove<spt::Action<SPTOrientation>, spt::QuaternionOrientationAction>(object.entity);
 }
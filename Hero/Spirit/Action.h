@@ -25,6 +25,8 @@ void SPTPositionActionDestroy(SPTObject object);
 // MARK: Orientation
 void SPTOrientationActionMakeLookAtTarget(SPTObject object, simd_float3 target, double duration, SPTEasingType easing);
 
+void SPTOrientationActionMakeQuaternion(SPTObject object, simd_quatf quaternion, double duration, SPTEasingType easing);
+
 bool SPTOrientationActionExists(SPTObject object);
 
 void SPTOrientationActionDestroy(SPTObject object);
@@ -0,0 +1,73 @@
+//
+//  AffineMatrix.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include <simd/simd.h>
+
+namespace spt {
+
+// Affine transformation stored as the first three rows of a 4x4 matrix,
+// the last row is implicitly (0, 0, 0, 1). Default constructed matrix is identity
+struct AffineMatrix {
+    simd_float4 rows[3] {
+        simd_float4 {1.f, 0.f, 0.f, 0.f},
+        simd_float4 {0.f, 1.f, 0.f, 0.f},
+        simd_float4 {0.f, 0.f, 1.f, 0.f}
+    };
+};
+
+static_assert(sizeof(AffineMatrix) == 12 * sizeof(float));
+
+inline AffineMatrix makeAffineMatrix(const simd_float3x3& upperLeft, simd_float3 translation) {
+    return AffineMatrix {{
+        simd_float4 {upperLeft.columns[0].x, upperLeft.columns[1].x, upperLeft.columns[2].x, translation.x},
+        simd_float4 {upperLeft.columns[0].y, upperLeft.columns[1].y, upperLeft.columns[2].y, translation.y},
+        simd_float4 {upperLeft.columns[0].z, upperLeft.columns[1].z, upperLeft.columns[2].z, translation.z}
+    }};
+}
+
+inline AffineMatrix makeAffineMatrix(const simd_float4x4& matrix) {
+    return AffineMatrix {{
+        simd_float4 {matrix.columns[0].x, matrix.columns[1].x, matrix.columns[2].x, matrix.columns[3].x},
+        simd_float4 {matrix.columns[0].y, matrix.columns[1].y, matrix.columns[2].y, matrix.columns[3].y},
+        simd_float4 {matrix.columns[0].z, matrix.columns[1].z, matrix.columns[2].z, matrix.columns[3].z}
+    }};
+}
+
+inline simd_float4x4 toMatrix4x4(const AffineMatrix& matrix) {
+    const auto& rows = matrix.rows;
+    return simd_float4x4 {{
+        simd_float4 {rows[0].x, rows[1].x, rows[2].x, 0.f},
+        simd_float4 {rows[0].y, rows[1].y, rows[2].y, 0.f},
+        simd_float4 {rows[0].z, rows[1].z, rows[2].z, 0.f},
+        simd_float4 {rows[0].w, rows[1].w, rows[2].w, 1.f}
+    }};
+}
+
+inline simd_float3 getTranslation(const AffineMatrix& matrix) {
+    return simd_float3 {matrix.rows[0].w, matrix.rows[1].w, matrix.rows[2].w};
+}
+
+// Row 'i' of the product is the combination of 'rhs' rows weighted by 'lhs' row 'i'
+// plus 'lhs' translation
+inline AffineMatrix multiply(const AffineMatrix& lhs, const AffineMatrix& rhs) {
+    AffineMatrix result;
+    for(int i = 0; i < 3; ++i) {
+        const auto& row = lhs.rows[i];
+        result.rows[i] = row.x * rhs.rows[0] + row.y * rhs.rows[1] + row.z * rhs.rows[2];
+        result.rows[i].w += row.w;
+    }
+    return result;
+}
+
+inline simd_float3 transformPoint(const AffineMatrix& matrix, simd_float3 point) {
+    const auto homogeneous = simd_make_float4(point, 1.f);
+    return simd_float3 {simd_dot(matrix.rows[0], homogeneous), simd_dot(matrix.rows[1], homogeneous), simd_dot(matrix.rows[2], homogeneous)};
+}
+
+}
@@ -30,6 +30,9 @@ typedef enum {
     SPTAnimatableObjectPropertyEulerOrientationY,
     SPTAnimatableObjectPropertyEulerOrientationZ,
     
+    // Angle around the rotation axis of the base quaternion
+    SPTAnimatableObjectPropertyQuaternionOrientationAngle,
+    
     SPTAnimatableObjectPropertyXYZScaleX,
     SPTAnimatableObjectPropertyXYZScaleY,
     SPTAnimatableObjectPropertyXYZScaleZ,
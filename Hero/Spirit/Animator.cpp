@@ -16,8 +16,8 @@ SPTAnimatorId SPTAnimatorMake(SPTAnimator object) {
     return spt::AnimatorManager::active().makeAnimator(object);
 }
 
-void SPTAnimatorUpdate(SPTAnimatorId id, SPTAnimator updated) {
-    spt::AnimatorManager::active().updateAnimator(id, updated);
+bool SPTAnimatorUpdate(SPTAnimatorId id, SPTAnimator updated) {
+    return spt::AnimatorManager::active().updateAnimator(id, updated);
 }
 
 void SPTAnimatorDestroy(SPTAnimatorId id) {
@@ -60,11 +60,3 @@ void SPTAnimatorRemoveCountWillChangeObserver(SPTObserverToken token) {
 float SPTAnimatorEvaluateValue(SPTAnimatorId id, SPTAnimatorEvaluationContext context) {
     return spt::AnimatorManager::active().evaluate(id, context);
 }
-
-void SPTAnimatorReset(SPTAnimatorId id) {
-    spt::AnimatorManager::active().resetAnimator(id);
-}
-
-void SPTAnimatorResetAll() {
-    spt::AnimatorManager::active().resetAllAnimators();
-}
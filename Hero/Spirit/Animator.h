@@ -44,7 +44,8 @@ bool SPTAnimatorEqual(SPTAnimator lhs, SPTAnimator rhs);
 
 SPTAnimatorId SPTAnimatorMake(SPTAnimator animator);
 
-void SPTAnimatorUpdate(SPTAnimatorId id, SPTAnimator updated);
+// Fails without changing the animator if 'updated' depends on 'id' through its operands
+bool SPTAnimatorUpdate(SPTAnimatorId id, SPTAnimator updated);
 
 void SPTAnimatorDestroy(SPTAnimatorId id);
 
@@ -64,10 +65,7 @@ typedef void (* _Nonnull SPTAnimatorCountWillChangeObserver) (size_t, SPTObserve
 SPTObserverToken SPTAnimatorAddCountWillChangeObserver(SPTAnimatorCountWillChangeObserver observer, SPTObserverUserInfo userInfo);
 void SPTAnimatorRemoveCountWillChangeObserver(SPTObserverToken token);
 
+// Animators are stateless, the value depends only on the animator and the context
 float SPTAnimatorEvaluateValue(SPTAnimatorId id, SPTAnimatorEvaluationContext context);
 
-void SPTAnimatorReset(SPTAnimatorId id);
-
-void SPTAnimatorResetAll();
-
 SPT_EXTERN_C_END
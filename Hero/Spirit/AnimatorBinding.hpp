@@ -13,9 +13,9 @@
 
 namespace spt {
 
+// Slot of the bound value written by 'AnimatorBindingEvaluator', 0 if the channel is not bound
 struct AnimatorBindingItemBase {
-    SPTAnimatorBinding binding;
-    size_t index;
+    uint32_t slot;
 };
 
 inline float evaluateAnimatorBinding(SPTAnimatorBinding binding, float animatorValue) {
@@ -0,0 +1,73 @@
+//
+//  AnimatorBindingEvaluator.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "AnimatorBindingEvaluator.hpp"
+
+#include <simd/simd.h>
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+
+namespace spt {
+
+namespace {
+
+template <typename T>
+std::vector<T> permute(const std::vector<T>& items, const std::vector<std::size_t>& order) {
+    std::vector<T> result;
+    result.reserve(items.size());
+    for(const auto index: order) {
+        result.push_back(items[index]);
+    }
+    return result;
+}
+
+}
+
+uint32_t AnimatorBindingEvaluator::addBinding(const SPTAnimatorBinding& binding, std::size_t animatorValueIndex) {
+    const auto slot = static_cast<uint32_t>(slotCount());
+    _valuesAt0.push_back(binding.valueAt0);
+    _valuesAt1.push_back(binding.valueAt1);
+    _animatorValueIndices.push_back(static_cast<uint32_t>(animatorValueIndex));
+    _slots.push_back(slot);
+    return slot;
+}
+
+void AnimatorBindingEvaluator::sortBindings() {
+    
+    std::vector<std::size_t> order (_slots.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this] (auto lhs, auto rhs) {
+        return _animatorValueIndices[lhs] < _animatorValueIndices[rhs];
+    });
+    
+    _valuesAt0 = permute(_valuesAt0, order);
+    _valuesAt1 = permute(_valuesAt1, order);
+    _animatorValueIndices = permute(_animatorValueIndices, order);
+    _slots = permute(_slots, order);
+}
+
+void AnimatorBindingEvaluator::evaluate(const std::vector<float>& animatorValues, const std::vector<uint8_t>& animatorValueChangeFlags, std::vector<float>& boundValues, std::vector<uint8_t>& boundValueChangeFlags) const {
+    assert(boundValues.size() == slotCount() && boundValueChangeFlags.size() == slotCount());
+    
+    const auto valuesAt0 = _valuesAt0.data();
+    const auto valuesAt1 = _valuesAt1.data();
+    const auto animatorValueIndices = _animatorValueIndices.data();
+    const auto slots = _slots.data();
+    const auto sourceValues = animatorValues.data();
+    const auto sourceFlags = animatorValueChangeFlags.data();
+    const auto destinationValues = boundValues.data();
+    const auto destinationFlags = boundValueChangeFlags.data();
+    
+    for(std::size_t i = 0; i < _slots.size(); ++i) {
+        destinationValues[slots[i]] = simd_mix(valuesAt0[i], valuesAt1[i], sourceValues[animatorValueIndices[i]]);
+        destinationFlags[slots[i]] = sourceFlags[animatorValueIndices[i]];
+    }
+}
+
+}
@@ -0,0 +1,42 @@
+//
+//  AnimatorBindingEvaluator.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "AnimatorBinding.h"
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace spt {
+
+// Evaluates all bindings of a playable scene in a single gather, interpolate and scatter pass.
+// Bindings are kept in parallel arrays ordered by animator value index, so that animator values
+// are read in order, and each binding writes to its own slot of the bound values array
+class AnimatorBindingEvaluator {
+public:
+    
+    // Returns the slot of the bound value, the slot at index 0 is reserved
+    uint32_t addBinding(const SPTAnimatorBinding& binding, std::size_t animatorValueIndex);
+    
+    // Orders bindings by animator value index, called once all bindings are added
+    void sortBindings();
+    
+    std::size_t slotCount() const { return _slots.size() + 1; }
+    
+    // Each slot is flagged if the value of its animator is flagged
+    void evaluate(const std::vector<float>& animatorValues, const std::vector<uint8_t>& animatorValueChangeFlags, std::vector<float>& boundValues, std::vector<uint8_t>& boundValueChangeFlags) const;
+
+private:
+    std::vector<float> _valuesAt0;
+    std::vector<float> _valuesAt1;
+    std::vector<uint32_t> _animatorValueIndices;
+    std::vector<uint32_t> _slots;
+};
+
+}
@@ -0,0 +1,173 @@
+//
+//  AnimatorCurveCache.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "AnimatorCurveCache.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace spt {
+
+namespace {
+
+constexpr uint32_t kFileMagic = 0x43415053; // 'SPAC'
+constexpr uint32_t kFileVersion = 2;
+
+// Header and samples are stored in host byte order, files are not portable between
+// hosts of different endianness
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t valueCount;
+    uint32_t sampleCount;
+    uint32_t samplingRate;
+    // 'AnimatorEvaluator::fingerprint' of the baked animators
+    uint32_t fingerprint;
+};
+
+constexpr float kQuantizationScale = 65535.f;
+
+inline uint16_t quantize(float value) {
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.f, 1.f) * kQuantizationScale));
+}
+
+}
+
+AnimatorCurveCache::AnimatorCurveCache(AnimatorCurveCache&& other)
+: _valueCount {other._valueCount}
+, _sampleCount {other._sampleCount}
+, _samplingRate {other._samplingRate}
+, _fingerprint {other._fingerprint}
+, _samples {other._samples}
+, _bakedSamples {std::move(other._bakedSamples)}
+, _mapping {std::exchange(other._mapping, nullptr)}
+, _mappingSize {std::exchange(other._mappingSize, 0)} {
+    other._samples = nullptr;
+}
+
+AnimatorCurveCache& AnimatorCurveCache::operator=(AnimatorCurveCache&& other) {
+    if(this != &other) {
+        unmap();
+        _valueCount = other._valueCount;
+        _sampleCount = other._sampleCount;
+        _samplingRate = other._samplingRate;
+        _fingerprint = other._fingerprint;
+        _samples = std::exchange(other._samples, nullptr);
+        _bakedSamples = std::move(other._bakedSamples);
+        _mapping = std::exchange(other._mapping, nullptr);
+        _mappingSize = std::exchange(other._mappingSize, 0);
+    }
+    return *this;
+}
+
+AnimatorCurveCache::~AnimatorCurveCache() {
+    unmap();
+}
+
+void AnimatorCurveCache::unmap() {
+    if(_mapping) {
+        munmap(_mapping, _mappingSize);
+        _mapping = nullptr;
+        _mappingSize = 0;
+    }
+}
+
+AnimatorCurveCache AnimatorCurveCache::bake(const AnimatorEvaluator& evaluator, double duration, uint32_t samplingRate) {
+    assert(duration > 0.0 && samplingRate > 0);
+    
+    AnimatorCurveCache cache;
+    cache._valueCount = static_cast<uint32_t>(evaluator.valueCount() - evaluator.timeValueBegin());
+    cache._sampleCount = std::max(static_cast<uint32_t>(std::ceil(duration * samplingRate)), 1u);
+    cache._samplingRate = samplingRate;
+    cache._fingerprint = evaluator.fingerprint();
+    cache._bakedSamples.resize(static_cast<std::size_t>(cache._valueCount) * cache._sampleCount);
+    
+    SPTAnimatorEvaluationContext context {};
+    context.samplingRate = samplingRate;
+    std::vector<float> values (evaluator.valueCount());
+    
+    for(uint32_t i = 0; i < cache._sampleCount; ++i) {
+        context.time = static_cast<double>(i) / samplingRate;
+        evaluator.evaluate(context, values.data(), evaluator.timeValueBegin(), values.size());
+        std::transform(values.begin() + evaluator.timeValueBegin(), values.end(), cache._bakedSamples.begin() + static_cast<std::size_t>(i) * cache._valueCount, quantize);
+    }
+    
+    cache._samples = cache._bakedSamples.data();
+    return cache;
+}
+
+std::optional<AnimatorCurveCache> AnimatorCurveCache::load(const char* path) {
+    
+    const auto fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        return std::nullopt;
+    }
+    
+    struct stat fileStat;
+    void* mapping = MAP_FAILED;
+    if(fstat(fd, &fileStat) == 0 && static_cast<std::size_t>(fileStat.st_size) >= sizeof(FileHeader)) {
+        mapping = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // Mapping stays valid after the descriptor is closed
+    close(fd);
+    
+    if(mapping == MAP_FAILED) {
+        return std::nullopt;
+    }
+    
+    AnimatorCurveCache cache;
+    cache._mapping = mapping;
+    cache._mappingSize = static_cast<std::size_t>(fileStat.st_size);
+    
+    const auto& header = *static_cast<const FileHeader*>(mapping);
+    if(header.magic != kFileMagic || header.version != kFileVersion || header.sampleCount == 0 || header.samplingRate == 0 ||
+       cache._mappingSize != sizeof(FileHeader) + static_cast<std::size_t>(header.valueCount) * header.sampleCount * sizeof(uint16_t)) {
+        return std::nullopt;
+    }
+    
+    cache._valueCount = header.valueCount;
+    cache._sampleCount = header.sampleCount;
+    cache._samplingRate = header.samplingRate;
+    cache._fingerprint = header.fingerprint;
+    cache._samples = reinterpret_cast<const uint16_t*>(static_cast<const char*>(mapping) + sizeof(FileHeader));
+    return cache;
+}
+
+bool AnimatorCurveCache::save(const char* path) const {
+    
+    auto file = std::fopen(path, "wb");
+    if(!file) {
+        return false;
+    }
+    
+    const FileHeader header {kFileMagic, kFileVersion, _valueCount, _sampleCount, _samplingRate, _fingerprint};
+    const auto sampleValueCount = static_cast<std::size_t>(_valueCount) * _sampleCount;
+    auto isWritten = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(_samples, sizeof(uint16_t), sampleValueCount, file) == sampleValueCount;
+    isWritten = (std::fclose(file) == 0) && isWritten;
+    
+    return isWritten;
+}
+
+void AnimatorCurveCache::read(double time, float* values) const {
+    // Nearest sample, so that frame times on the sampling grid are not affected by rounding errors
+    const auto sampleIndex = static_cast<uint64_t>(std::llround(std::max(time, 0.0) * _samplingRate)) % _sampleCount;
+    const auto samples = _samples + sampleIndex * _valueCount;
+    for(uint32_t i = 0; i < _valueCount; ++i) {
+        values[i] = samples[i] * (1.f / kQuantizationScale);
+    }
+}
+
+}
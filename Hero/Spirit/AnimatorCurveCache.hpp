@@ -0,0 +1,65 @@
+//
+//  AnimatorCurveCache.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "AnimatorEvaluator.hpp"
+
+#include <optional>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace spt {
+
+// Time dependent animator values baked at a fixed sampling rate over a time range and
+// quantized to 16 bits. Samples are stored time major so that a frame reads a single row.
+// Playback loops over the baked range and is identical between runs
+class AnimatorCurveCache {
+public:
+    
+    AnimatorCurveCache(AnimatorCurveCache&& other);
+    AnimatorCurveCache& operator=(AnimatorCurveCache&& other);
+    ~AnimatorCurveCache();
+    
+    // Values of 'evaluator' in [timeValueBegin, valueCount) over [0, duration)
+    static AnimatorCurveCache bake(const AnimatorEvaluator& evaluator, double duration, uint32_t samplingRate);
+    
+    // Memory maps a file written by 'save', empty if the file is missing or malformed
+    static std::optional<AnimatorCurveCache> load(const char* path);
+    
+    bool save(const char* path) const;
+    
+    // Writes 'valueCount' values of the sample at 'time'
+    void read(double time, float* values) const;
+    
+    std::size_t valueCount() const { return _valueCount; }
+    
+    // Fingerprint of the evaluator the cache was baked from
+    uint32_t fingerprint() const { return _fingerprint; }
+
+private:
+    
+    AnimatorCurveCache() = default;
+    AnimatorCurveCache(const AnimatorCurveCache&) = delete;
+    AnimatorCurveCache& operator=(const AnimatorCurveCache&) = delete;
+    
+    void unmap();
+    
+    uint32_t _valueCount = 0;
+    uint32_t _sampleCount = 0;
+    uint32_t _samplingRate = 0;
+    uint32_t _fingerprint = 0;
+    // Point either to '_bakedSamples' or to the mapped file
+    const uint16_t* _samples = nullptr;
+    std::vector<uint16_t> _bakedSamples;
+    void* _mapping = nullptr;
+    std::size_t _mappingSize = 0;
+    
+};
+
+}
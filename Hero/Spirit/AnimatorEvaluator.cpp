@@ -0,0 +1,333 @@
+//
+//  AnimatorEvaluator.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "AnimatorEvaluator.hpp"
+#include "AnimatorManager.hpp"
+#include "AnimatorSource.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+
+namespace spt {
+
+namespace {
+
+constexpr std::size_t kInterpolationCount = SPTEasingTypeSmootherStep + 1;
+
+// Tape registers directly follow the reserved value
+constexpr std::size_t kTapeValueBegin = 1;
+
+// FNV-1a over the bytes of 'value'
+template <typename T>
+void combineFingerprint(uint32_t& fingerprint, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>);
+    const auto bytes = reinterpret_cast<const unsigned char*>(&value);
+    for(std::size_t i = 0; i < sizeof(T); ++i) {
+        fingerprint = (fingerprint ^ bytes[i]) * 16777619u;
+    }
+}
+
+void combineFingerprint(uint32_t& fingerprint, float value) {
+    combineFingerprint(fingerprint, std::bit_cast<uint32_t>(value));
+}
+
+template <typename T>
+void combineFingerprint(uint32_t& fingerprint, const std::vector<T>& values) {
+    combineFingerprint(fingerprint, static_cast<uint64_t>(values.size()));
+    for(const auto& value: values) {
+        combineFingerprint(fingerprint, value);
+    }
+}
+
+template <SPTEasingType E>
+inline float evaluateEasing(float x) {
+    if constexpr (E == SPTEasingTypeLinear) {
+        return SPTEasingEvaluateLinear(x);
+    } else if constexpr (E == SPTEasingTypeSmoothStep) {
+        return SPTEasingEvaluateSmoothStep(x);
+    } else {
+        return SPTEasingEvaluateSmootherStep(x);
+    }
+}
+
+// Branch free loops over parallel arrays, the interpolation is known at compile time
+template <SPTEasingType E>
+void evaluateValueNoiseValues(std::size_t count, const uint32_t* seeds, const float* frequencies, const SPTAnimatorEvaluationContext& context, float* values) {
+    for(std::size_t i = 0; i < count; ++i) {
+        const auto phase = AnimatorSource::getPhase(frequencies[i], context);
+        values[i] = AnimatorSource::evaluateValueNoise(seeds[i], phase, evaluateEasing<E>(phase.fraction));
+    }
+}
+
+template <SPTEasingType E>
+void evaluatePerlinNoiseValues(std::size_t count, const uint32_t* seeds, const float* frequencies, const SPTAnimatorEvaluationContext& context, float* values) {
+    for(std::size_t i = 0; i < count; ++i) {
+        const auto phase = AnimatorSource::getPhase(frequencies[i], context);
+        values[i] = AnimatorSource::evaluatePerlinNoise(seeds[i], phase, evaluateEasing<E>(phase.fraction));
+    }
+}
+
+template <SPTEasingType E>
+void evaluateOscillatorValues(std::size_t count, const float* frequencies, const SPTAnimatorEvaluationContext& context, float* values) {
+    for(std::size_t i = 0; i < count; ++i) {
+        const auto phase = AnimatorSource::getPhase(frequencies[i], context);
+        values[i] = AnimatorSource::evaluateOscillator(phase, evaluateEasing<E>(phase.fraction));
+    }
+}
+
+}
+
+AnimatorEvaluator::AnimatorEvaluator(std::span<const SPTAnimatorId> animatorIds)
+: _valueIndices(animatorIds.size()) {
+    
+    const auto& animatorManager = AnimatorManager::active();
+    
+    // Animator indices of each partition
+    std::vector<std::size_t> compositeAnimatorIndices;
+    std::vector<std::size_t> panAnimatorIndices[2];
+    std::vector<std::size_t> randomAnimatorIndices;
+    std::vector<std::size_t> valueNoiseAnimatorIndices[kInterpolationCount];
+    std::vector<std::size_t> perlinNoiseAnimatorIndices[kInterpolationCount];
+    std::vector<std::size_t> oscillatorAnimatorIndices[kInterpolationCount];
+    
+    for(std::size_t i = 0; i < animatorIds.size(); ++i) {
+        const auto& source = animatorManager.getAnimator(animatorIds[i]).source;
+        switch (source.type) {
+            case SPTAnimatorSourceTypePan: {
+                panAnimatorIndices[source.pan.axis].push_back(i);
+                break;
+            }
+            case SPTAnimatorSourceTypeRandom: {
+                randomAnimatorIndices.push_back(i);
+                break;
+            }
+            case SPTAnimatorSourceTypeNoise: {
+                switch (source.noise.type) {
+                    case SPTNoiseTypeValue:
+                        valueNoiseAnimatorIndices[source.noise.interpolation].push_back(i);
+                        break;
+                    case SPTNoiseTypePerlin:
+                        perlinNoiseAnimatorIndices[source.noise.interpolation].push_back(i);
+                        break;
+                }
+                break;
+            }
+            case SPTAnimatorSourceTypeOscillator: {
+                oscillatorAnimatorIndices[source.oscillator.interpolation].push_back(i);
+                break;
+            }
+            case SPTAnimatorSourceTypeComposite: {
+                compositeAnimatorIndices.push_back(i);
+                break;
+            }
+        }
+    }
+    
+    // Composites may depend on any source including pan, hence the tape comes first and is always evaluated live
+    std::vector<SPTAnimatorId> compositeAnimatorIds;
+    for(const auto animatorIndex: compositeAnimatorIndices) {
+        compositeAnimatorIds.push_back(animatorIds[animatorIndex]);
+    }
+    std::vector<uint32_t> registers;
+    _tape = animatorManager.compile(compositeAnimatorIds, registers);
+    for(std::size_t i = 0; i < compositeAnimatorIndices.size(); ++i) {
+        _valueIndices[compositeAnimatorIndices[i]] = kTapeValueBegin + registers[i];
+    }
+    
+    // Partitions occupy consecutive value ranges in the order they are laid out
+    std::size_t nextValueIndex = kTapeValueBegin + _tape.instructions.size();
+    const auto assignValueIndices = [this, &nextValueIndex] (const std::vector<std::size_t>& animatorIndices) {
+        const auto valueBegin = nextValueIndex;
+        for(const auto animatorIndex: animatorIndices) {
+            _valueIndices[animatorIndex] = nextValueIndex++;
+        }
+        return valueBegin;
+    };
+    
+    for(int axis = SPTPanAnimatorSourceAxisHorizontal; axis <= SPTPanAnimatorSourceAxisVertical; ++axis) {
+        auto& partition = _panPartitions[axis];
+        partition.valueBegin = assignValueIndices(panAnimatorIndices[axis]);
+        for(const auto animatorIndex: panAnimatorIndices[axis]) {
+            const auto& pan = animatorManager.getAnimator(animatorIds[animatorIndex]).source.pan;
+            partition.minValues.push_back(pan.bottomLeft[axis]);
+            partition.maxValues.push_back(pan.topRight[axis]);
+        }
+    }
+    
+    _randomPartition.valueBegin = assignValueIndices(randomAnimatorIndices);
+    for(const auto animatorIndex: randomAnimatorIndices) {
+        const auto& random = animatorManager.getAnimator(animatorIds[animatorIndex]).source.random;
+        _randomPartition.seeds.push_back(random.seed);
+        _randomPartition.frequencies.push_back(random.frequency);
+    }
+    
+    for(std::size_t interpolation = 0; interpolation < kInterpolationCount; ++interpolation) {
+        if(const auto& animatorIndices = valueNoiseAnimatorIndices[interpolation]; !animatorIndices.empty()) {
+            auto& partition = _valueNoisePartitions.emplace_back(InterpolationPartition {assignValueIndices(animatorIndices), static_cast<SPTEasingType>(interpolation)});
+            for(const auto animatorIndex: animatorIndices) {
+                const auto& noise = animatorManager.getAnimator(animatorIds[animatorIndex]).source.noise;
+                partition.seeds.push_back(noise.seed);
+                partition.frequencies.push_back(noise.frequency);
+            }
+        }
+        
+        if(const auto& animatorIndices = perlinNoiseAnimatorIndices[interpolation]; !animatorIndices.empty()) {
+            auto& partition = _perlinNoisePartitions.emplace_back(InterpolationPartition {assignValueIndices(animatorIndices), static_cast<SPTEasingType>(interpolation)});
+            for(const auto animatorIndex: animatorIndices) {
+                const auto& noise = animatorManager.getAnimator(animatorIds[animatorIndex]).source.noise;
+                partition.seeds.push_back(noise.seed);
+                partition.frequencies.push_back(noise.frequency);
+            }
+        }
+        
+        if(const auto& animatorIndices = oscillatorAnimatorIndices[interpolation]; !animatorIndices.empty()) {
+            auto& partition = _oscillatorPartitions.emplace_back(InterpolationPartition {assignValueIndices(animatorIndices), static_cast<SPTEasingType>(interpolation)});
+            for(const auto animatorIndex: animatorIndices) {
+                partition.frequencies.push_back(animatorManager.getAnimator(animatorIds[animatorIndex]).source.oscillator.frequency);
+            }
+        }
+    }
+    
+    _valueCount = nextValueIndex;
+    
+    // Layout of values and parameters of time dependent sources determine baked curves
+    _fingerprint = 2166136261u;
+    for(std::size_t i = 0; i < animatorIds.size(); ++i) {
+        combineFingerprint(_fingerprint, animatorIds[i]);
+        combineFingerprint(_fingerprint, static_cast<uint64_t>(_valueIndices[i]));
+    }
+    combineFingerprint(_fingerprint, _randomPartition.seeds);
+    combineFingerprint(_fingerprint, _randomPartition.frequencies);
+    for(const auto partitions: {&_valueNoisePartitions, &_perlinNoisePartitions, &_oscillatorPartitions}) {
+        combineFingerprint(_fingerprint, static_cast<uint64_t>(partitions->size()));
+        for(const auto& partition: *partitions) {
+            combineFingerprint(_fingerprint, static_cast<uint32_t>(partition.interpolation));
+            combineFingerprint(_fingerprint, partition.seeds);
+            combineFingerprint(_fingerprint, partition.frequencies);
+        }
+    }
+}
+
+void AnimatorEvaluator::evaluate(const SPTAnimatorEvaluationContext& context, std::vector<float>& values) const {
+    assert(values.size() == valueCount());
+    evaluate(context, values.data(), 1, values.size());
+}
+
+void AnimatorEvaluator::evaluateParallel(const SPTAnimatorEvaluationContext& context, std::vector<float>& values, ThreadPool& threadPool) const {
+    assert(values.size() == valueCount());
+    threadPool.parallelFor(1, values.size(), kParallelizationGrainSize, [this, &context, &values] (std::size_t begin, std::size_t end) {
+        evaluate(context, values.data(), begin, end);
+    });
+}
+
+void AnimatorEvaluator::evaluate(const SPTAnimatorEvaluationContext& context, float* values, std::size_t begin, std::size_t end) const {
+    
+    // Part of the partition values that falls into [begin, end), relative to the partition start
+    const auto clip = [begin, end] (std::size_t valueBegin, std::size_t count) {
+        return std::make_pair(std::clamp(begin, valueBegin, valueBegin + count) - valueBegin, std::clamp(end, valueBegin, valueBegin + count) - valueBegin);
+    };
+    
+    if(!_tape.instructions.empty() && begin <= kTapeValueBegin && kTapeValueBegin < end) {
+        _tape.evaluate(context, values + kTapeValueBegin);
+    }
+    
+    for(int axis = SPTPanAnimatorSourceAxisHorizontal; axis <= SPTPanAnimatorSourceAxisVertical; ++axis) {
+        const auto& partition = _panPartitions[axis];
+        if(const auto [first, last] = clip(partition.valueBegin, partition.minValues.size()); first < last) {
+            evaluate(partition, context.panLocation[axis], first, last, values + partition.valueBegin);
+        }
+    }
+    
+    if(const auto [first, last] = clip(_randomPartition.valueBegin, _randomPartition.seeds.size()); first < last) {
+        evaluate(_randomPartition, context, first, last, values + _randomPartition.valueBegin);
+    }
+    
+    for(const auto& partition: _valueNoisePartitions) {
+        if(const auto [first, last] = clip(partition.valueBegin, partition.frequencies.size()); first < last) {
+            evaluateValueNoise(partition, context, first, last, values + partition.valueBegin);
+        }
+    }
+    
+    for(const auto& partition: _perlinNoisePartitions) {
+        if(const auto [first, last] = clip(partition.valueBegin, partition.frequencies.size()); first < last) {
+            evaluatePerlinNoise(partition, context, first, last, values + partition.valueBegin);
+        }
+    }
+    
+    for(const auto& partition: _oscillatorPartitions) {
+        if(const auto [first, last] = clip(partition.valueBegin, partition.frequencies.size()); first < last) {
+            evaluateOscillator(partition, context, first, last, values + partition.valueBegin);
+        }
+    }
+}
+
+void AnimatorEvaluator::evaluate(const PanPartition& partition, float location, std::size_t first, std::size_t last, float* values) {
+    for(auto i = first; i < last; ++i) {
+        const auto minValue = partition.minValues[i];
+        const auto maxValue = partition.maxValues[i];
+        values[i] = (simd_clamp(location, minValue, maxValue) - minValue) / (maxValue - minValue);
+    }
+}
+
+void AnimatorEvaluator::evaluate(const RandomPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values) {
+    for(auto i = first; i < last; ++i) {
+        values[i] = AnimatorSource::evaluateRandom(partition.seeds[i], AnimatorSource::getPhase(partition.frequencies[i], context));
+    }
+}
+
+void AnimatorEvaluator::evaluateValueNoise(const InterpolationPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values) {
+    const auto seeds = partition.seeds.data() + first;
+    const auto frequencies = partition.frequencies.data() + first;
+    switch (partition.interpolation) {
+        case SPTEasingTypeLinear:
+            evaluateValueNoiseValues<SPTEasingTypeLinear>(last - first, seeds, frequencies, context, values + first);
+            break;
+        case SPTEasingTypeSmoothStep:
+            evaluateValueNoiseValues<SPTEasingTypeSmoothStep>(last - first, seeds, frequencies, context, values + first);
+            break;
+        case SPTEasingTypeSmootherStep:
+            evaluateValueNoiseValues<SPTEasingTypeSmootherStep>(last - first, seeds, frequencies, context, values + first);
+            break;
+    }
+}
+
+void AnimatorEvaluator::evaluatePerlinNoise(const InterpolationPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values) {
+    const auto seeds = partition.seeds.data() + first;
+    const auto frequencies = partition.frequencies.data() + first;
+    switch (partition.interpolation) {
+        case SPTEasingTypeLinear:
+            evaluatePerlinNoiseValues<SPTEasingTypeLinear>(last - first, seeds, frequencies, context, values + first);
+            break;
+        case SPTEasingTypeSmoothStep:
+            evaluatePerlinNoiseValues<SPTEasingTypeSmoothStep>(last - first, seeds, frequencies, context, values + first);
+            break;
+        case SPTEasingTypeSmootherStep:
+            evaluatePerlinNoiseValues<SPTEasingTypeSmootherStep>(last - first, seeds, frequencies, context, values + first);
+            break;
+    }
+}
+
+void AnimatorEvaluator::evaluateOscillator(const InterpolationPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values) {
+    const auto frequencies = partition.frequencies.data() + first;
+    switch (partition.interpolation) {
+        case SPTEasingTypeLinear:
+            evaluateOscillatorValues<SPTEasingTypeLinear>(last - first, frequencies, context, values + first);
+            break;
+        case SPTEasingTypeSmoothStep:
+            evaluateOscillatorValues<SPTEasingTypeSmoothStep>(last - first, frequencies, context, values + first);
+            break;
+        case SPTEasingTypeSmootherStep:
+            evaluateOscillatorValues<SPTEasingTypeSmootherStep>(last - first, frequencies, context, values + first);
+            break;
+    }
+}
+
+}
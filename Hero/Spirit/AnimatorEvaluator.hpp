@@ -0,0 +1,104 @@
+//
+//  AnimatorEvaluator.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "Base.hpp"
+#include "Animator.h"
+#include "Easing.h"
+#include "AnimatorTape.hpp"
+#include "ThreadPool.hpp"
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace spt {
+
+// Evaluates a fixed set of animators in batches. Animators are partitioned by source type
+// (and by interpolation where it applies) with each partition keeping its parameters
+// in parallel arrays and writing to a contiguous range of the values array.
+// Composite animators are compiled into a tape whose registers are the first values
+class AnimatorEvaluator {
+public:
+    
+    // Fewer values are evaluated on the calling thread
+    static constexpr std::size_t kParallelizationThreshold = 4096;
+    static constexpr std::size_t kParallelizationGrainSize = 1024;
+    
+    AnimatorEvaluator() = default;
+    explicit AnimatorEvaluator(std::span<const SPTAnimatorId> animatorIds);
+    
+    // Index of the value of 'animatorIds[animatorIndex]', the value at index 0 is reserved
+    std::size_t valueIndex(std::size_t animatorIndex) const { return _valueIndices[animatorIndex]; }
+    
+    std::size_t valueCount() const { return _valueCount; }
+    
+    // Composite and pan animators come first, values starting from this index depend only on time
+    std::size_t timeValueBegin() const { return _randomPartition.valueBegin; }
+    
+    // Hash of animator identifiers, value layout and parameters of time dependent animators
+    uint32_t fingerprint() const { return _fingerprint; }
+    
+    void evaluate(const SPTAnimatorEvaluationContext& context, std::vector<float>& values) const;
+    
+    // Values are split into chunks evaluated by pool threads. Animators are stateless
+    // and chunks write disjoint value ranges, hence nothing is shared between threads
+    void evaluateParallel(const SPTAnimatorEvaluationContext& context, std::vector<float>& values, ThreadPool& threadPool) const;
+    
+    // Evaluates animators with value indices in [begin, end). The tape is evaluated
+    // as a whole by the range containing its first register
+    void evaluate(const SPTAnimatorEvaluationContext& context, float* values, std::size_t begin, std::size_t end) const;
+
+private:
+    
+    struct PanPartition {
+        std::size_t valueBegin = 0;
+        std::vector<float> minValues;
+        std::vector<float> maxValues;
+    };
+    
+    struct RandomPartition {
+        std::size_t valueBegin = 0;
+        std::vector<uint32_t> seeds;
+        std::vector<float> frequencies;
+    };
+    
+    // Noise and oscillator animators interpolating within periods
+    struct InterpolationPartition {
+        std::size_t valueBegin;
+        SPTEasingType interpolation;
+        // Empty for oscillators
+        std::vector<uint32_t> seeds;
+        std::vector<float> frequencies;
+    };
+    
+    // Partition functions evaluate animators in [first, last) of the partition, 'values' start at the partition
+    static void evaluate(const PanPartition& partition, float location, std::size_t first, std::size_t last, float* values);
+    static void evaluate(const RandomPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values);
+    
+    static void evaluateValueNoise(const InterpolationPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values);
+    static void evaluatePerlinNoise(const InterpolationPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values);
+    static void evaluateOscillator(const InterpolationPartition& partition, const SPTAnimatorEvaluationContext& context, std::size_t first, std::size_t last, float* values);
+    
+    std::vector<std::size_t> _valueIndices;
+    std::size_t _valueCount = 1;
+    uint32_t _fingerprint = 0;
+    
+    AnimatorTape _tape;
+    
+    // Horizontal and vertical axes
+    PanPartition _panPartitions[2];
+    RandomPartition _randomPartition;
+    std::vector<InterpolationPartition> _valueNoisePartitions;
+    std::vector<InterpolationPartition> _perlinNoisePartitions;
+    std::vector<InterpolationPartition> _oscillatorPartitions;
+    
+};
+
+}
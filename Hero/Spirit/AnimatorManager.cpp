@@ -9,10 +9,13 @@
 #include "AnimatorManager.hpp"
 #include "ComponentObserverUtil.hpp"
 #include "ObjectPropertyAnimatorBinding.h"
+#include "AnimatorSource.hpp"
 #include "Easing.h"
 
 #include <algorithm>
-#include <random>
+#include <cmath>
+#include <map>
+#include <tuple>
 #include <vector>
 
 
@@ -20,74 +23,212 @@ namespace spt {
 
 namespace {
 
-std::uniform_real_distribution<float> uniformDistribution0_1;
-std::uniform_real_distribution<float> uniformDistribution1_1 {-1.f, 1.f};
-
 struct AnimatorBindingMetadata {
     
     std::vector<SPTObjectAnimatorBindingMetadataItem> objectBindingMetadata;
     
 };
 
-struct RandomAnimatorState {
+// Operand time relative to the time of the composite it is compiled for
+struct TimeTransform {
+    double scale;
+    double offset;
+};
+
+// Octave 'index' runs 'lacunarity^index' times faster
+inline double getOctaveTimeScale(const SPTCompositeAnimatorSource& composite, uint32_t index) {
+    return std::pow(static_cast<double>(composite.octaves.lacunarity), index);
+}
+
+inline float getOctavesTotalWeight(const SPTCompositeAnimatorSource& composite) {
+    float weight = 1.f;
+    float totalWeight = 0.f;
+    for(uint32_t i = 0; i < composite.octaves.count; ++i) {
+        totalWeight += weight;
+        weight *= composite.octaves.gain;
+    }
+    return totalWeight;
+}
+
+class AnimatorTapeCompiler {
+public:
     
-    void reset(uint32_t seed) {
-        randomEngine.seed(seed);
-        lastValueGenerationTime = 0.0;
-        period = 0.0;
+    AnimatorTapeCompiler(const AnimatorManager& animatorManager, AnimatorTape& tape)
+    : _animatorManager {animatorManager}
+    , _tape {tape} {
     }
     
-    std::minstd_rand randomEngine;
-    double lastValueGenerationTime;
-    double period;
-    float lastValue;
-};
-
-struct ValueNoiseAnimatorState {
+    // Animators are compiled once per time transform, hence shared operands are not expanded repeatedly
+    uint32_t compile(SPTAnimatorId id, const TimeTransform& transform) {
+        // Once the tape is full operands are no longer expanded
+        if(_tape.instructions.size() >= AnimatorTape::kMaxInstructionCount) {
+            _isOverflown = true;
+            return compileConstant();
+        }
+        const auto key = std::make_tuple(id, transform.scale, transform.offset);
+        if(const auto it = _animatorRegisters.find(key); it != _animatorRegisters.end()) {
+            return it->second;
+        }
+        const auto result = compileAnimator(id, transform);
+        _animatorRegisters.emplace(key, result);
+        return result;
+    }
+    
+    // Whether the tape got full, the animator being compiled and all following ones are incomplete
+    bool isOverflown() const { return _isOverflown; }
     
-    void reset(uint32_t seed) {
-        randomEngine.seed(seed);
-        startTime = 0.0;
-        interpolationDuration = 0.0;
-        startValue = 0.f;
-        targetValue = uniformDistribution0_1(randomEngine);
+    uint32_t compileConstant() {
+        return emit(AnimatorTape::Instruction {});
     }
     
-    std::minstd_rand randomEngine;
-    double startTime;
-    double interpolationDuration;
-    float startValue;
-    float targetValue;
-};
-
-struct PerlinNoiseAnimatorState {
+private:
     
-    void reset(uint32_t seed) {
-        randomEngine.seed(seed);
-        startTime = 0.0;
-        interpolationDuration = 0.0;
-        startGradient = 0.f;
-        targetGradient = uniformDistribution1_1(randomEngine);
+    uint32_t compileAnimator(SPTAnimatorId id, const TimeTransform& transform) {
+        
+        AnimatorTape::Instruction instruction {};
+        if(!_animatorManager.animatorExists(id)) {
+            return emit(instruction);
+        }
+        
+        instruction.timeScale = transform.scale;
+        instruction.timeOffset = transform.offset;
+        
+        const auto& source = _animatorManager.getAnimator(id).source;
+        switch (source.type) {
+            case SPTAnimatorSourceTypePan: {
+                instruction.opcode = AnimatorTape::Opcode::pan;
+                instruction.variant = source.pan.axis;
+                instruction.parameters[0] = source.pan.bottomLeft[source.pan.axis];
+                instruction.parameters[1] = source.pan.topRight[source.pan.axis];
+                break;
+            }
+            case SPTAnimatorSourceTypeRandom: {
+                instruction.opcode = AnimatorTape::Opcode::random;
+                instruction.seed = source.random.seed;
+                instruction.parameters[0] = source.random.frequency;
+                break;
+            }
+            case SPTAnimatorSourceTypeNoise: {
+                instruction.opcode = (source.noise.type == SPTNoiseTypeValue ? AnimatorTape::Opcode::valueNoise : AnimatorTape::Opcode::perlinNoise);
+                instruction.variant = source.noise.interpolation;
+                instruction.seed = source.noise.seed;
+                instruction.parameters[0] = source.noise.frequency;
+                break;
+            }
+            case SPTAnimatorSourceTypeOscillator: {
+                instruction.opcode = AnimatorTape::Opcode::oscillator;
+                instruction.variant = source.oscillator.interpolation;
+                instruction.parameters[0] = source.oscillator.frequency;
+                break;
+            }
+            case SPTAnimatorSourceTypeComposite: {
+                return compileComposite(source.composite, transform);
+            }
+        }
+        
+        return emit(instruction);
     }
     
-    std::minstd_rand randomEngine;
-    double startTime;
-    double interpolationDuration;
-    float startGradient;
-    float targetGradient;
-};
-
-struct OscillatorAnimatorState {
+    uint32_t compileComposite(const SPTCompositeAnimatorSource& composite, const TimeTransform& transform) {
+        
+        AnimatorTape::Instruction instruction {};
+        
+        switch (composite.operation) {
+            case SPTCompositeAnimatorOperationSum: {
+                instruction.opcode = AnimatorTape::Opcode::weightedSum;
+                instruction.operands[0] = compile(composite.operands[0], transform);
+                instruction.operands[1] = compile(composite.operands[1], transform);
+                instruction.parameters[0] = 1.f;
+                instruction.parameters[1] = 1.f;
+                break;
+            }
+            case SPTCompositeAnimatorOperationProduct: {
+                instruction.opcode = AnimatorTape::Opcode::product;
+                instruction.operands[0] = compile(composite.operands[0], transform);
+                instruction.operands[1] = compile(composite.operands[1], transform);
+                break;
+            }
+            case SPTCompositeAnimatorOperationRemap: {
+                instruction.opcode = AnimatorTape::Opcode::remap;
+                instruction.operands[0] = compile(composite.operands[0], transform);
+                instruction.parameters[0] = composite.range.minValue;
+                instruction.parameters[1] = composite.range.maxValue;
+                break;
+            }
+            case SPTCompositeAnimatorOperationClamp: {
+                instruction.opcode = AnimatorTape::Opcode::clamp;
+                instruction.operands[0] = compile(composite.operands[0], transform);
+                instruction.parameters[0] = composite.range.minValue;
+                instruction.parameters[1] = composite.range.maxValue;
+                break;
+            }
+            case SPTCompositeAnimatorOperationDelay: {
+                // Folded into the time of the operand
+                return compile(composite.operands[0], TimeTransform {transform.scale, transform.offset - composite.delay});
+            }
+            case SPTCompositeAnimatorOperationOctaves: {
+                // Octaves are accumulated pairwise, each octave is the operand at a scaled time
+                const auto totalWeight = getOctavesTotalWeight(composite);
+                auto result = compile(composite.operands[0], transform);
+                auto resultWeight = 1.f / totalWeight;
+                auto weight = 1.f;
+                for(uint32_t i = 1; i < composite.octaves.count; ++i) {
+                    weight *= composite.octaves.gain;
+                    const auto timeScale = getOctaveTimeScale(composite, i);
+                    instruction.opcode = AnimatorTape::Opcode::weightedSum;
+                    instruction.operands[0] = result;
+                    instruction.operands[1] = compile(composite.operands[0], TimeTransform {transform.scale * timeScale, transform.offset * timeScale});
+                    instruction.parameters[0] = resultWeight;
+                    instruction.parameters[1] = weight / totalWeight;
+                    result = emit(instruction);
+                    resultWeight = 1.f;
+                }
+                return result;
+            }
+        }
+        
+        return emit(instruction);
+    }
     
-    void reset() {
-        startTime = 0.0;
-        interpolationDuration = 0.0;
-        targetValue = 1.f;
+    // Returns the register of an equal instruction if there is one
+    uint32_t emit(AnimatorTape::Instruction instruction) {
+        
+        switch (instruction.opcode) {
+            case AnimatorTape::Opcode::random:
+            case AnimatorTape::Opcode::valueNoise:
+            case AnimatorTape::Opcode::perlinNoise:
+            case AnimatorTape::Opcode::oscillator:
+                break;
+            case AnimatorTape::Opcode::weightedSum:
+            case AnimatorTape::Opcode::product:
+                // Commutative operations are keyed with ordered operands
+                if(instruction.operands[0] > instruction.operands[1] && instruction.parameters[0] == instruction.parameters[1]) {
+                    std::swap(instruction.operands[0], instruction.operands[1]);
+                }
+                [[fallthrough]];
+            default:
+                // Only sources depend on time
+                instruction.timeScale = 1.0;
+                instruction.timeOffset = 0.0;
+                break;
+        }
+        
+        const auto key = std::make_tuple(instruction.opcode, instruction.variant, instruction.seed, instruction.operands[0], instruction.operands[1], instruction.parameters[0], instruction.parameters[1], instruction.timeScale, instruction.timeOffset);
+        if(const auto it = _instructionRegisters.find(key); it != _instructionRegisters.end()) {
+            return it->second;
+        }
+        
+        const auto result = static_cast<uint32_t>(_tape.instructions.size());
+        _tape.instructions.push_back(instruction);
+        _instructionRegisters.emplace(key, result);
+        return result;
     }
     
-    double startTime;
-    double interpolationDuration;
-    float targetValue;
+    const AnimatorManager& _animatorManager;
+    AnimatorTape& _tape;
+    std::map<std::tuple<SPTAnimatorId, double, double>, uint32_t> _animatorRegisters;
+    std::map<std::tuple<AnimatorTape::Opcode, uint32_t, uint32_t, uint32_t, uint32_t, float, float, double, double>, uint32_t> _instructionRegisters;
+    bool _isOverflown = false;
 };
 
 }
@@ -106,40 +247,20 @@ SPTAnimatorId AnimatorManager::makeAnimator(const SPTAnimator& animator) {
     _registry.emplace<SPTAnimator>(id, animator);
     _registry.emplace<AnimatorBindingMetadata>(id);
     
-    switch (animator.source.type) {
-        case SPTAnimatorSourceTypePan:
-            break;
-        case SPTAnimatorSourceTypeRandom: {
-            _registry.emplace<RandomAnimatorState>(id);
-            break;
-        }
-        case SPTAnimatorSourceTypeNoise: {
-            switch (animator.source.noise.type) {
-                case SPTNoiseTypeValue:
-                    _registry.emplace<ValueNoiseAnimatorState>(id);
-                    break;
-                case SPTNoiseTypePerlin:
-                    _registry.emplace<PerlinNoiseAnimatorState>(id);
-                    break;
-            }
-            
-            break;
-        }
-        case SPTAnimatorSourceTypeOscillator: {
-            _registry.emplace<OscillatorAnimatorState>(id);
-            break;
-        }
-    }
-    
     return id;
 }
 
-void AnimatorManager::updateAnimator(SPTAnimatorId id, const SPTAnimator& updated) {
+bool AnimatorManager::updateAnimator(SPTAnimatorId id, const SPTAnimator& updated) {
     assert(validateAnimator(updated));
     
+    if(dependsOn(updated, id)) {
+        return false;
+    }
+    
     spt::notifyComponentWillChangeObservers(_registry, id, updated);
     spt::notifyComponentDidChangeObservers(_registry, id, spt::update(_registry, id, updated));
-
+    
+    return true;
 }
 
 void AnimatorManager::destroyAnimator(SPTAnimatorId animatorId) {
@@ -208,10 +329,44 @@ bool AnimatorManager::validateAnimator(const SPTAnimator& animator) {
         case SPTAnimatorSourceTypeOscillator: {
             return animator.source.oscillator.frequency >= 0.f;
         }
+        case SPTAnimatorSourceTypeComposite: {
+            const auto& composite = animator.source.composite;
+            if(!animatorExists(composite.operands[0])) {
+                return false;
+            }
+            switch (composite.operation) {
+                case SPTCompositeAnimatorOperationSum:
+                case SPTCompositeAnimatorOperationProduct:
+                    return animatorExists(composite.operands[1]);
+                case SPTCompositeAnimatorOperationRemap:
+                    return true;
+                case SPTCompositeAnimatorOperationClamp:
+                    return composite.range.minValue <= composite.range.maxValue;
+                case SPTCompositeAnimatorOperationDelay:
+                    return composite.delay >= 0.f;
+                case SPTCompositeAnimatorOperationOctaves:
+                    return composite.octaves.count > 0 && composite.octaves.count <= kSPTCompositeAnimatorMaxOctaveCount && composite.octaves.lacunarity > 0.f && composite.octaves.gain >= 0.f;
+            }
+        }
+    }
+}
+
+bool AnimatorManager::dependsOn(const SPTAnimator& animator, SPTAnimatorId id) const {
+    if(animator.source.type != SPTAnimatorSourceTypeComposite) {
+        return false;
+    }
+    const auto& composite = animator.source.composite;
+    const auto operandCount = (composite.operation == SPTCompositeAnimatorOperationSum || composite.operation == SPTCompositeAnimatorOperationProduct ? 2 : 1);
+    for(int i = 0; i < operandCount; ++i) {
+        const auto operand = composite.operands[i];
+        if(operand == id || (animatorExists(operand) && dependsOn(getAnimator(operand), id))) {
+            return true;
+        }
     }
+    return false;
 }
 
-float AnimatorManager::evaluate(SPTAnimatorId id, const SPTAnimatorEvaluationContext& context) {
+float AnimatorManager::evaluate(SPTAnimatorId id, const SPTAnimatorEvaluationContext& context) const {
     
     const auto& animator = _registry.get<SPTAnimator>(id);
     
@@ -220,20 +375,37 @@ float AnimatorManager::evaluate(SPTAnimatorId id, const SPTAnimatorEvaluationCon
             return evaluatePan(animator, context);
         }
         case SPTAnimatorSourceTypeRandom: {
-            return evaluateRandom(id, animator, context);
+            return evaluateRandom(animator, context);
         }
         case SPTAnimatorSourceTypeNoise: {
             switch (animator.source.noise.type) {
                 case SPTNoiseTypeValue:
-                    return evaluateValueNoise(id, animator, context);
+                    return evaluateValueNoise(animator, context);
                 case SPTNoiseTypePerlin:
-                    return evaluatePerlinNoise(id, animator, context);
+                    return evaluatePerlinNoise(animator, context);
             }
         }
         case SPTAnimatorSourceTypeOscillator: {
-            return evaluateOscillator(id, animator, context);
+            return evaluateOscillator(animator, context);
+        }
+        case SPTAnimatorSourceTypeComposite: {
+            return evaluateComposite(animator, context);
+        }
+    }
+}
+
+AnimatorTape AnimatorManager::compile(std::span<const SPTAnimatorId> animatorIds, std::vector<uint32_t>& registers) const {
+    AnimatorTape tape;
+    AnimatorTapeCompiler compiler {*this, tape};
+    registers.resize(animatorIds.size());
+    for(std::size_t i = 0; i < animatorIds.size(); ++i) {
+        registers[i] = compiler.compile(animatorIds[i], TimeTransform {1.0, 0.0});
+        // Incomplete animators would evaluate to wrong values
+        if(compiler.isOverflown()) {
+            registers[i] = compiler.compileConstant();
         }
     }
+    return tape;
 }
 
 float AnimatorManager::evaluatePan(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
@@ -249,105 +421,63 @@ float AnimatorManager::evaluatePan(const SPTAnimator& animator, const SPTAnimato
     }
 }
 
-float AnimatorManager::evaluateRandom(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
-    
-    auto& state = _registry.get<RandomAnimatorState>(id);
-    while(context.time - state.lastValueGenerationTime >= state.period) {
-        state.lastValue = uniformDistribution0_1(state.randomEngine);
-        state.lastValueGenerationTime += state.period;
-        state.period = 1.f / std::min(animator.source.random.frequency, static_cast<float>(context.samplingRate));
-    }
-    return state.lastValue;
+float AnimatorManager::evaluateRandom(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
+    const auto phase = AnimatorSource::getPhase(animator.source.random.frequency, context);
+    return AnimatorSource::evaluateRandom(animator.source.random.seed, phase);
 }
 
-float AnimatorManager::evaluateValueNoise(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
-    
-    auto& state = _registry.get<ValueNoiseAnimatorState>(id);
-    while(context.time - state.startTime >= state.interpolationDuration) {
-        state.startValue = state.targetValue;
-        state.targetValue = uniformDistribution0_1(state.randomEngine);
-        state.startTime += state.interpolationDuration;
-        state.interpolationDuration = 1.f / std::min(animator.source.noise.frequency, static_cast<float>(context.samplingRate));
-    }
-    const auto t = SPTEasingEvaluate(animator.source.noise.interpolation, static_cast<float>((context.time - state.startTime) / state.interpolationDuration));
-    return simd_mix(state.startValue, state.targetValue, t);
+float AnimatorManager::evaluateValueNoise(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
+    const auto phase = AnimatorSource::getPhase(animator.source.noise.frequency, context);
+    return AnimatorSource::evaluateValueNoise(animator.source.noise.seed, phase, SPTEasingEvaluate(animator.source.noise.interpolation, phase.fraction));
 }
 
-float AnimatorManager::evaluatePerlinNoise(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
-    
-    auto& state = _registry.get<PerlinNoiseAnimatorState>(id);
-    while(context.time - state.startTime >= state.interpolationDuration) {
-        state.startGradient = state.targetGradient;
-        state.targetGradient = uniformDistribution1_1(state.randomEngine);
-        state.startTime += state.interpolationDuration;
-        state.interpolationDuration = 1.f / std::min(animator.source.noise.frequency, static_cast<float>(context.samplingRate));
-    }
-    const auto t = static_cast<float>((context.time - state.startTime) / state.interpolationDuration);
-    // The interpolation result is in [-0.5, 0.5] range, therefore bringing to [0, 1] range
-    return 0.5f + simd_mix(state.startGradient * t, state.targetGradient * (t - 1.f), SPTEasingEvaluate(animator.source.noise.interpolation, t));
+float AnimatorManager::evaluatePerlinNoise(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
+    const auto phase = AnimatorSource::getPhase(animator.source.noise.frequency, context);
+    return AnimatorSource::evaluatePerlinNoise(animator.source.noise.seed, phase, SPTEasingEvaluate(animator.source.noise.interpolation, phase.fraction));
 }
 
-float AnimatorManager::evaluateOscillator(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
-    
-    auto& state = _registry.get<OscillatorAnimatorState>(id);
-    while(context.time - state.startTime >= state.interpolationDuration) {
-        state.targetValue = 1.f - state.targetValue;
-        state.startTime += state.interpolationDuration;
-        state.interpolationDuration = 1.f / std::min(animator.source.oscillator.frequency, static_cast<float>(context.samplingRate));
-    }
-    const auto t = SPTEasingEvaluate(animator.source.oscillator.interpolation, static_cast<float>((context.time - state.startTime) / state.interpolationDuration));
-    return simd_mix(1.f - state.targetValue, state.targetValue, t);
-    
+float AnimatorManager::evaluateOscillator(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) {
+    const auto phase = AnimatorSource::getPhase(animator.source.oscillator.frequency, context);
+    return AnimatorSource::evaluateOscillator(phase, SPTEasingEvaluate(animator.source.oscillator.interpolation, phase.fraction));
 }
 
-void AnimatorManager::resetAnimator(SPTAnimatorId id) {
-    const auto& animator = _registry.get<SPTAnimator>(id);
-    switch (animator.source.type) {
-        case SPTAnimatorSourceTypePan: {
-            break;
+// Same arithmetic as the compiled tape, used for evaluating a single animator
+float AnimatorManager::evaluateComposite(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) const {
+    const auto& composite = animator.source.composite;
+    switch (composite.operation) {
+        case SPTCompositeAnimatorOperationSum: {
+            return evaluateOperand(composite.operands[0], context) + evaluateOperand(composite.operands[1], context);
         }
-        case SPTAnimatorSourceTypeRandom: {
-            _registry.get<RandomAnimatorState>(id).reset(animator.source.random.seed);
-            break;
+        case SPTCompositeAnimatorOperationProduct: {
+            return evaluateOperand(composite.operands[0], context) * evaluateOperand(composite.operands[1], context);
         }
-        case SPTAnimatorSourceTypeNoise: {
-            switch (animator.source.noise.type) {
-                case SPTNoiseTypeValue:
-                    _registry.get<ValueNoiseAnimatorState>(id).reset(animator.source.noise.seed);
-                    break;
-                case SPTNoiseTypePerlin:
-                    _registry.get<PerlinNoiseAnimatorState>(id).reset(animator.source.noise.seed);
-                    break;
-            }
-            break;
+        case SPTCompositeAnimatorOperationRemap: {
+            return simd_mix(composite.range.minValue, composite.range.maxValue, evaluateOperand(composite.operands[0], context));
         }
-        case SPTAnimatorSourceTypeOscillator: {
-            _registry.get<OscillatorAnimatorState>(id).reset();
-            break;
+        case SPTCompositeAnimatorOperationClamp: {
+            return simd_clamp(evaluateOperand(composite.operands[0], context), composite.range.minValue, composite.range.maxValue);
+        }
+        case SPTCompositeAnimatorOperationDelay: {
+            auto delayedContext = context;
+            delayedContext.time -= composite.delay;
+            return evaluateOperand(composite.operands[0], delayedContext);
+        }
+        case SPTCompositeAnimatorOperationOctaves: {
+            auto octaveContext = context;
+            auto weight = 1.f;
+            auto value = 0.f;
+            for(uint32_t i = 0; i < composite.octaves.count; ++i) {
+                octaveContext.time = context.time * getOctaveTimeScale(composite, i);
+                value += weight * evaluateOperand(composite.operands[0], octaveContext);
+                weight *= composite.octaves.gain;
+            }
+            return value / getOctavesTotalWeight(composite);
         }
     }
 }
 
-void AnimatorManager::resetAllAnimators() {
-    _registry.view<SPTAnimator, RandomAnimatorState>().each([](auto entity, const auto& animator, auto& state) {
-        assert(animator.source.type == SPTAnimatorSourceTypeRandom);
-        state.reset(animator.source.random.seed);
-    });
-    
-    _registry.view<SPTAnimator, ValueNoiseAnimatorState>().each([](auto entity, const auto& animator, auto& state) {
-        assert(animator.source.type == SPTAnimatorSourceTypeNoise && animator.source.noise.type == SPTNoiseTypeValue);
-        state.reset(animator.source.noise.seed);
-    });
-    
-    _registry.view<SPTAnimator, PerlinNoiseAnimatorState>().each([](auto entity, const auto& animator, auto& state) {
-        assert(animator.source.type == SPTAnimatorSourceTypeNoise && animator.source.noise.type == SPTNoiseTypePerlin);
-        state.reset(animator.source.noise.seed);
-    });
-    
-    _registry.view<SPTAnimator, OscillatorAnimatorState>().each([](auto entity, const auto& animator, auto& state) {
-        assert(animator.source.type == SPTAnimatorSourceTypeOscillator);
-        state.reset();
-    });
+float AnimatorManager::evaluateOperand(SPTAnimatorId operand, const SPTAnimatorEvaluationContext& context) const {
+    return animatorExists(operand) ? evaluate(operand, context) : 0.f;
 }
 
 void AnimatorManager::onObjectPropertyBind(SPTAnimatorId animatorId, SPTObject object, SPTAnimatableObjectProperty property) {
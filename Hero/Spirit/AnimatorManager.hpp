@@ -8,6 +8,7 @@
 #pragma once
 
 #include "Animator.h"
+#include "AnimatorTape.hpp"
 #include "Base.hpp"
 
 #include <vector>
@@ -24,7 +25,8 @@ public:
     
     SPTAnimatorId makeAnimator(const SPTAnimator& animator);
     
-    void updateAnimator(SPTAnimatorId animatorId, const SPTAnimator& updated);
+    // Composites forming a cycle are rejected as they can not be evaluated
+    bool updateAnimator(SPTAnimatorId animatorId, const SPTAnimator& updated);
     
     void destroyAnimator(SPTAnimatorId id);
     
@@ -42,26 +44,32 @@ public:
     SPTObserverToken addCountWillChangeObserver(SPTAnimatorCountWillChangeObserver observer, SPTObserverUserInfo userInfo);
     void removeCountWillChangeObserver(SPTObserverToken token);
     
-    float evaluate(SPTAnimatorId id, const SPTAnimatorEvaluationContext& context);
+    // Depends only on the animator and the context
+    float evaluate(SPTAnimatorId id, const SPTAnimatorEvaluationContext& context) const;
     
-    void resetAnimator(SPTAnimatorId id);
-    void resetAllAnimators();
+    // Composite animators compiled into a single tape, the value of 'animatorIds[i]' is written to 'registers[i]'
+    AnimatorTape compile(std::span<const SPTAnimatorId> animatorIds, std::vector<uint32_t>& registers) const;
     
     void onObjectPropertyBind(SPTAnimatorId animatorId, SPTObject object, SPTAnimatableObjectProperty property);
     void onObjectPropertyUnbind(SPTAnimatorId animatorId, SPTObject object, SPTAnimatableObjectProperty property);
     
 private:
     
-    float evaluatePan(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
-    float evaluateRandom(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
-    float evaluateValueNoise(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
-    float evaluatePerlinNoise(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
-    float evaluateOscillator(SPTAnimatorId id, const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
+    static float evaluatePan(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
+    static float evaluateRandom(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
+    static float evaluateValueNoise(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
+    static float evaluatePerlinNoise(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
+    static float evaluateOscillator(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context);
+    float evaluateComposite(const SPTAnimator& animator, const SPTAnimatorEvaluationContext& context) const;
+    float evaluateOperand(SPTAnimatorId operand, const SPTAnimatorEvaluationContext& context) const;
     
     void notifyCountListeners(size_t newValue);
     
     bool validateAnimator(const SPTAnimator& updated);
     
+    // Whether 'id' is an operand of the animator, directly or through other composites
+    bool dependsOn(const SPTAnimator& animator, SPTAnimatorId id) const;
+    
     AnimatorManager() = default;
     AnimatorManager(const AnimatorManager&) = delete;
     AnimatorManager(AnimatorManager&&) = delete;
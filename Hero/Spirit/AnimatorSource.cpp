@@ -23,6 +23,29 @@ bool SPTOscillatorAnimatorSourceEqual(SPTOscillatorAnimatorSource lhs, SPTOscill
     return lhs.frequency == rhs.frequency && lhs.interpolation == rhs.interpolation;
 }
 
+bool SPTCompositeAnimatorSourceEqual(SPTCompositeAnimatorSource lhs, SPTCompositeAnimatorSource rhs) {
+    if(lhs.operation != rhs.operation || lhs.operands[0] != rhs.operands[0]) {
+        return false;
+    }
+    
+    switch (lhs.operation) {
+        case SPTCompositeAnimatorOperationSum:
+        case SPTCompositeAnimatorOperationProduct: {
+            return lhs.operands[1] == rhs.operands[1];
+        }
+        case SPTCompositeAnimatorOperationRemap:
+        case SPTCompositeAnimatorOperationClamp: {
+            return lhs.range.minValue == rhs.range.minValue && lhs.range.maxValue == rhs.range.maxValue;
+        }
+        case SPTCompositeAnimatorOperationDelay: {
+            return lhs.delay == rhs.delay;
+        }
+        case SPTCompositeAnimatorOperationOctaves: {
+            return lhs.octaves.count == rhs.octaves.count && lhs.octaves.lacunarity == rhs.octaves.lacunarity && lhs.octaves.gain == rhs.octaves.gain;
+        }
+    }
+}
+
 bool SPTAnimatorSourceEqual(SPTAnimatorSource lhs, SPTAnimatorSource rhs) {
     if(lhs.type != rhs.type) {
         return false;
@@ -41,5 +64,8 @@ bool SPTAnimatorSourceEqual(SPTAnimatorSource lhs, SPTAnimatorSource rhs) {
         case SPTAnimatorSourceTypeOscillator: {
             return SPTOscillatorAnimatorSourceEqual(lhs.oscillator, rhs.oscillator);
         }
+        case SPTAnimatorSourceTypeComposite: {
+            return SPTCompositeAnimatorSourceEqual(lhs.composite, rhs.composite);
+        }
     }
 }
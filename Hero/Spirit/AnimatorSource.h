@@ -19,6 +19,7 @@ typedef enum {
     SPTAnimatorSourceTypeRandom,
     SPTAnimatorSourceTypeNoise,
     SPTAnimatorSourceTypeOscillator,
+    SPTAnimatorSourceTypeComposite,
 } __attribute__((enum_extensibility(open))) SPTAnimatorSourceType;
 
 typedef enum {
@@ -62,6 +63,42 @@ typedef struct {
 
 bool SPTOscillatorAnimatorSourceEqual(SPTOscillatorAnimatorSource lhs, SPTOscillatorAnimatorSource rhs);
 
+typedef enum {
+    SPTCompositeAnimatorOperationSum,
+    SPTCompositeAnimatorOperationProduct,
+    SPTCompositeAnimatorOperationRemap,
+    SPTCompositeAnimatorOperationClamp,
+    SPTCompositeAnimatorOperationDelay,
+    SPTCompositeAnimatorOperationOctaves
+} __attribute__((enum_extensibility(closed))) SPTCompositeAnimatorOperation;
+
+#define kSPTCompositeAnimatorMaxOctaveCount 16
+
+// Combines values of other animators, operands that no longer exist evaluate to 0
+typedef struct {
+    SPTCompositeAnimatorOperation operation;
+    // Second operand is used by sum and product only
+    SPTAnimatorId operands[2];
+    union {
+        // Remap maps [0, 1] to the range, clamp limits to it
+        struct {
+            float minValue;
+            float maxValue;
+        } range;
+        // Seconds the operand lags behind
+        float delay;
+        // Sum of 'count' copies of the operand, each next one 'lacunarity' times faster and 'gain' times weaker,
+        // normalized by the total weight. 'count' is in [1, kSPTCompositeAnimatorMaxOctaveCount]
+        struct {
+            uint32_t count;
+            float lacunarity;
+            float gain;
+        } octaves;
+    };
+} SPTCompositeAnimatorSource;
+
+bool SPTCompositeAnimatorSourceEqual(SPTCompositeAnimatorSource lhs, SPTCompositeAnimatorSource rhs);
+
 typedef struct {
     SPTAnimatorSourceType type;
     union {
@@ -69,6 +106,7 @@ typedef struct {
         SPTRandomAnimatorSource random;
         SPTNoiseAnimatorSource noise;
         SPTOscillatorAnimatorSource oscillator;
+        SPTCompositeAnimatorSource composite;
     };
 } SPTAnimatorSource;
 
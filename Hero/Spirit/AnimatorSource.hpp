@@ -0,0 +1,66 @@
+//
+//  AnimatorSource.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "Animator.h"
+#include "AnimatorSource.h"
+
+#include <simd/simd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace spt::AnimatorSource {
+
+// Random sources are piecewise over periods of '1 / frequency' seconds, shortened to
+// the sampling period for high frequencies. Values within a period depend only on the seed,
+// the period index and the fraction of the period passed, hence any time is evaluated in O(1)
+struct Phase {
+    int64_t index;
+    float fraction;
+};
+
+inline Phase getPhase(float frequency, const SPTAnimatorEvaluationContext& context) {
+    const double period = 1.f / std::min(frequency, static_cast<float>(context.samplingRate));
+    const auto periods = context.time / period;
+    const auto index = std::floor(periods);
+    return Phase {static_cast<int64_t>(index), static_cast<float>(periods - index)};
+}
+
+// Uniformly distributed in [0, 1), SplitMix64 finalizer of the seed and index pair
+inline float hashToUnitInterval(uint32_t seed, int64_t index) {
+    auto x = (static_cast<uint64_t>(seed) << 32) + static_cast<uint64_t>(index) + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    // Top 24 bits are exactly representable
+    return static_cast<float>(x >> 40) * 0x1p-24f;
+}
+
+inline float evaluateRandom(uint32_t seed, const Phase& phase) {
+    return hashToUnitInterval(seed, phase.index);
+}
+
+inline float evaluateValueNoise(uint32_t seed, const Phase& phase, float easedFraction) {
+    return simd_mix(hashToUnitInterval(seed, phase.index), hashToUnitInterval(seed, phase.index + 1), easedFraction);
+}
+
+inline float evaluatePerlinNoise(uint32_t seed, const Phase& phase, float easedFraction) {
+    const auto startGradient = 2.f * hashToUnitInterval(seed, phase.index) - 1.f;
+    const auto targetGradient = 2.f * hashToUnitInterval(seed, phase.index + 1) - 1.f;
+    // The interpolation result is in [-0.5, 0.5] range, therefore bringing to [0, 1] range
+    return 0.5f + simd_mix(startGradient * phase.fraction, targetGradient * (phase.fraction - 1.f), easedFraction);
+}
+
+// Even periods go from 1 to 0, odd ones back
+inline float evaluateOscillator(const Phase& phase, float easedFraction) {
+    const auto startValue = (phase.index & 1 ? 0.f : 1.f);
+    return simd_mix(startValue, 1.f - startValue, easedFraction);
+}
+
+}
@@ -0,0 +1,74 @@
+//
+//  AnimatorTape.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "AnimatorTape.hpp"
+#include "AnimatorSource.hpp"
+
+#include <simd/simd.h>
+
+
+namespace spt {
+
+void AnimatorTape::evaluate(const SPTAnimatorEvaluationContext& context, float* registers) const {
+    
+    auto sourceContext = context;
+    
+    for(std::size_t i = 0; i < instructions.size(); ++i) {
+        const auto& instruction = instructions[i];
+        sourceContext.time = context.time * instruction.timeScale + instruction.timeOffset;
+        
+        switch (instruction.opcode) {
+            case Opcode::constant: {
+                registers[i] = instruction.parameters[0];
+                break;
+            }
+            case Opcode::pan: {
+                const auto minValue = instruction.parameters[0];
+                const auto maxValue = instruction.parameters[1];
+                registers[i] = (simd_clamp(context.panLocation[instruction.variant], minValue, maxValue) - minValue) / (maxValue - minValue);
+                break;
+            }
+            case Opcode::random: {
+                registers[i] = AnimatorSource::evaluateRandom(instruction.seed, AnimatorSource::getPhase(instruction.parameters[0], sourceContext));
+                break;
+            }
+            case Opcode::valueNoise: {
+                const auto phase = AnimatorSource::getPhase(instruction.parameters[0], sourceContext);
+                registers[i] = AnimatorSource::evaluateValueNoise(instruction.seed, phase, SPTEasingEvaluate(static_cast<SPTEasingType>(instruction.variant), phase.fraction));
+                break;
+            }
+            case Opcode::perlinNoise: {
+                const auto phase = AnimatorSource::getPhase(instruction.parameters[0], sourceContext);
+                registers[i] = AnimatorSource::evaluatePerlinNoise(instruction.seed, phase, SPTEasingEvaluate(static_cast<SPTEasingType>(instruction.variant), phase.fraction));
+                break;
+            }
+            case Opcode::oscillator: {
+                const auto phase = AnimatorSource::getPhase(instruction.parameters[0], sourceContext);
+                registers[i] = AnimatorSource::evaluateOscillator(phase, SPTEasingEvaluate(static_cast<SPTEasingType>(instruction.variant), phase.fraction));
+                break;
+            }
+            case Opcode::weightedSum: {
+                registers[i] = registers[instruction.operands[0]] * instruction.parameters[0] + registers[instruction.operands[1]] * instruction.parameters[1];
+                break;
+            }
+            case Opcode::product: {
+                registers[i] = registers[instruction.operands[0]] * registers[instruction.operands[1]];
+                break;
+            }
+            case Opcode::remap: {
+                registers[i] = simd_mix(instruction.parameters[0], instruction.parameters[1], registers[instruction.operands[0]]);
+                break;
+            }
+            case Opcode::clamp: {
+                registers[i] = simd_clamp(registers[instruction.operands[0]], instruction.parameters[0], instruction.parameters[1]);
+                break;
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,62 @@
+//
+//  AnimatorTape.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "Animator.h"
+#include "Easing.h"
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace spt {
+
+// Composite animators compiled into a flat list of instructions in dependency order.
+// Each instruction writes a single register, the register index is the instruction index.
+// Delays and octaves are folded into time transforms of source instructions, and equal
+// instructions are emitted once, hence shared subexpressions are evaluated once per frame
+struct AnimatorTape {
+    
+    enum class Opcode: uint8_t {
+        constant,
+        pan,
+        random,
+        valueNoise,
+        perlinNoise,
+        oscillator,
+        weightedSum,
+        product,
+        remap,
+        clamp
+    };
+    
+    struct Instruction {
+        Opcode opcode;
+        // Pan axis or interpolation
+        uint32_t variant = 0;
+        uint32_t seed = 0;
+        // Registers of earlier instructions
+        uint32_t operands[2] = {0, 0};
+        // Source frequency, pan bounds, operand weights or range
+        float parameters[2] = {0.f, 0.f};
+        // Sources are evaluated at 'time * timeScale + timeOffset'
+        double timeScale = 1.0;
+        double timeOffset = 0.0;
+    };
+    
+    // Octaves expand their operand once per octave, so nested ones grow the tape exponentially.
+    // Animators compiled after the tape gets full evaluate to 0
+    static constexpr std::size_t kMaxInstructionCount = 1 << 16;
+    
+    void evaluate(const SPTAnimatorEvaluationContext& context, float* registers) const;
+    
+    std::vector<Instruction> instructions;
+    
+};
+
+}
@@ -31,6 +31,10 @@ enum SPTOrientationAction {
         SPTOrientationActionMakeLookAtTarget(object, target, duration, easing)
     }
     
+    static func make(quaternion: simd_quatf, duration: Double, easing: SPTEasingType, object: SPTObject) {
+        SPTOrientationActionMakeQuaternion(object, quaternion, duration, easing)
+    }
+    
     static func exists(object: SPTObject) {
         SPTOrientationActionExists(object)
     }
@@ -24,6 +24,7 @@ extension SPTAnimatableObjectProperty: SPTAnimatableProperty, CaseIterable {
         .eulerOrientationX,
         .eulerOrientationY,
         .eulerOrientationZ,
+        .quaternionOrientationAngle,
         .xyzScaleX,
         .xyzScaleY,
         .xyzScaleZ,
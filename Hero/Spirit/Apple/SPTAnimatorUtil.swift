@@ -78,7 +78,8 @@ extension SPTAnimator: Equatable {
         SPTAnimatorMake(animator)
     }
     
-    static func update(_ animator: SPTAnimator, id: SPTAnimatorId) {
+    @discardableResult
+    static func update(_ animator: SPTAnimator, id: SPTAnimatorId) -> Bool {
         SPTAnimatorUpdate(id, animator)
     }
     
@@ -140,14 +141,6 @@ extension SPTAnimator: Equatable {
         SPTAnimatorEvaluateValue(id, context)
     }
     
-    static func reset(id: SPTAnimatorId) {
-        SPTAnimatorReset(id)
-    }
-    
-    static func resetAll() {
-        SPTAnimatorResetAll()
-    }
-    
 }
 
 @propertyWrapper
@@ -102,6 +102,10 @@ extension SPTOrientation: SPTInspectableComponent {
         self.init(model: .zxAxis, .init(zxAxes: zxAxes))
     }
     
+    init(quaternion: simd_quatf) {
+        self.init(model: .quaternion, .init(quaternion: quaternion))
+    }
+    
     public static func == (lhs: SPTOrientation, rhs: SPTOrientation) -> Bool {
         SPTOrientationEqual(lhs, rhs)
     }
@@ -158,6 +162,10 @@ extension SPTOrientation: SPTInspectableComponent {
         SPTOrientationToEulerZYX(self)
     }
     
+    func toQuaternion(position: simd_float3) -> SPTOrientation {
+        SPTOrientationToQuaternion(self, position)
+    }
+    
     func toPointAtDirection(axis: SPTAxis, directionLength: Float = 1.0) -> SPTOrientation {
         SPTOrientationToPointAtDirection(self, axis, directionLength)
     }
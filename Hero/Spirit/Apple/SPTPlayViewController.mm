@@ -78,7 +78,7 @@
        self.renderingContext.renderPassDescriptor != nil) {
         
         self.renderingContext.renderPassDescriptor.colorAttachments[0].storeAction = MTLStoreActionStoreAndMultisampleResolve;
-        _renderer.render(scene->registry, (__bridge void*) self.renderingContext);
+        _renderer.render(scene->registry, scene->sharedRegistry(), scene->sharedEntities(), (__bridge void*) self.renderingContext);
         
         [commandBuffer commit];
         [commandBuffer waitUntilScheduled];
@@ -11,8 +11,11 @@ import Foundation
 class SPTPlayableSceneProxy: Identifiable {
     
     let handle: SPTHandle
+    // Static objects are rendered from the scene, hence it is kept alive while playing
+    private let scene: SPTSceneProxy
     
     init(scene: SPTSceneProxy, viewCameraEntity: SPTEntity, animatorIds: [SPTAnimatorId]? = nil) {
+        self.scene = scene
         var descriptor = SPTPlayableSceneDescriptor()
         descriptor.viewCameraEntity = viewCameraEntity
         if let animatorIds {
@@ -20,12 +20,34 @@ class SPTSceneProxy {
         SPTSceneDestroy(handle)
     }
     
+    var isFrozen: Bool {
+        SPTSceneIsFrozen(handle)
+    }
+    
     func makeObject() -> SPTObject {
         SPTSceneMakeObject(handle)
     }
     
+    func makeObjects(count: Int, objectsTemplate: SPTObjectsTemplate) -> [SPTObject] {
+        guard count > 0 else {
+            return []
+        }
+        return [SPTObject](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            SPTSceneMakeObjects(handle, count, objectsTemplate, buffer.baseAddress!)
+            initializedCount = count
+        }
+    }
+    
     static func destroyObject(_ object: SPTObject) {
         SPTSceneDestroyObject(object)
     }
     
+    static func destroyObjects(_ objects: [SPTObject]) {
+        SPTSceneDestroyObjects(objects, objects.count)
+    }
+    
+    static func destroyObjectDeferred(_ object: SPTObject) {
+        SPTSceneDestroyObjectDeferred(object)
+    }
+    
 }
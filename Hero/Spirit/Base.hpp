@@ -20,6 +20,8 @@ using Registry = entt::basic_registry<SPTEntity>;
 
 using AnimatorRegistry = entt::basic_registry<SPTAnimatorId>;
 
+using EntitySet = entt::basic_sparse_set<SPTEntity>;
+
 template <typename EIt>
 bool checkValid(const Registry& registry, EIt first, EIt last) {
     return std::all_of(first, last, [&registry] (const auto entity) { return registry.valid(entity); });
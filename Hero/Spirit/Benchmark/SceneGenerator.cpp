@@ -0,0 +1,191 @@
+//
+//  SceneGenerator.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "SceneGenerator.hpp"
+#include "Scene.h"
+#include "Transformation.h"
+#include "Position.h"
+#include "Orientation.h"
+#include "Scale.h"
+#include "MeshLook.h"
+#include "RayCast.h"
+#include "Animator.h"
+#include "ObjectPropertyAnimatorBinding.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+namespace spt::benchmark {
+
+namespace {
+
+// Transformation node level is 16 bit
+constexpr std::size_t kMaxChainLength = std::numeric_limits<uint16_t>::max();
+
+constexpr std::array kTransformationProperties {
+    SPTAnimatableObjectPropertyCartesianPositionX,
+    SPTAnimatableObjectPropertyCartesianPositionY,
+    SPTAnimatableObjectPropertyCartesianPositionZ,
+    SPTAnimatableObjectPropertyEulerOrientationX,
+    SPTAnimatableObjectPropertyEulerOrientationY,
+    SPTAnimatableObjectPropertyEulerOrientationZ,
+    SPTAnimatableObjectPropertyXYZScaleX,
+    SPTAnimatableObjectPropertyXYZScaleY,
+    SPTAnimatableObjectPropertyXYZScaleZ,
+};
+
+std::size_t parentIndex(const HierarchyDescriptor& descriptor, std::size_t index, std::minstd_rand& randomEngine) {
+    constexpr auto kNoParent = std::numeric_limits<std::size_t>::max();
+    if(index == 0) {
+        return kNoParent;
+    }
+    
+    switch (descriptor.shape) {
+        case HierarchyShape::deepChain: {
+            const auto chainLength = std::clamp<std::size_t>(descriptor.branchParameter, 1, kMaxChainLength);
+            return (index % chainLength == 0 ? kNoParent : index - 1);
+        }
+        case HierarchyShape::wideFanOut: {
+            return (index - 1) / std::max<std::size_t>(descriptor.branchParameter, 1);
+        }
+        case HierarchyShape::randomForest: {
+            if(randomEngine() % std::max<std::size_t>(descriptor.branchParameter, 1) == 0) {
+                return kNoParent;
+            }
+            return randomEngine() % index;
+        }
+    }
+}
+
+}
+
+const char* toString(HierarchyShape shape) {
+    switch (shape) {
+        case HierarchyShape::deepChain:
+            return "chain";
+        case HierarchyShape::wideFanOut:
+            return "fanout";
+        case HierarchyShape::randomForest:
+            return "forest";
+    }
+}
+
+std::vector<SPTObject> makeHierarchy(SPTHandle sceneHandle, const HierarchyDescriptor& descriptor) {
+    
+    std::minstd_rand randomEngine {descriptor.seed};
+    std::uniform_real_distribution<float> positionDistribution {-10.f, 10.f};
+    std::uniform_real_distribution<float> angleDistribution {-static_cast<float>(M_PI), static_cast<float>(M_PI)};
+    
+    std::vector<SPTPosition> positions (descriptor.objectCount);
+    std::vector<SPTOrientation> orientations (descriptor.objectCount);
+    std::vector<SPTScale> scales (descriptor.objectCount, SPTScale {SPTScaleModelXYZ, .xyz = {1.f, 1.f, 1.f}});
+    
+    for(std::size_t i = 0; i < descriptor.objectCount; ++i) {
+        positions[i] = SPTPosition {SPTCoordinateSystemCartesian, .cartesian = {positionDistribution(randomEngine), positionDistribution(randomEngine), positionDistribution(randomEngine)}};
+        orientations[i] = SPTOrientation {SPTOrientationModelEulerXYZ, .euler = {angleDistribution(randomEngine), angleDistribution(randomEngine), angleDistribution(randomEngine)}};
+    }
+    
+    std::vector<SPTObject> objects (descriptor.objectCount);
+    SPTSceneMakeObjects(sceneHandle, descriptor.objectCount, SPTObjectsTemplate {positions.data(), orientations.data(), scales.data(), nullptr}, objects.data());
+    
+    for(std::size_t i = 0; i < descriptor.objectCount; ++i) {
+        if(const auto parent = parentIndex(descriptor, i, randomEngine); parent < i) {
+            SPTTransformationSetParent(objects[i], objects[parent].entity);
+        }
+    }
+    
+    return objects;
+}
+
+void makeRayCastableMeshLooks(const std::vector<SPTObject>& objects, SPTMeshId meshId) {
+    SPTMeshLook meshLook {};
+    meshLook.shading.type = SPTMeshShadingTypePlainColor;
+    meshLook.shading.plainColor.color.model = SPTColorModelRGB;
+    meshLook.shading.plainColor.color.rgba.float4 = {1.f, 1.f, 1.f, 1.f};
+    meshLook.meshId = meshId;
+    meshLook.categories = kSPTLookCategoriesAll;
+    
+    for(const auto& object: objects) {
+        SPTMeshLookMake(object, meshLook);
+        SPTRayCastableMake(object);
+    }
+}
+
+std::vector<SPTAnimatorId> makeAnimators(std::size_t count, uint32_t seed) {
+    
+    std::minstd_rand randomEngine {seed};
+    std::uniform_real_distribution<float> frequencyDistribution {0.1f, 10.f};
+    
+    std::vector<SPTAnimatorId> animatorIds;
+    animatorIds.reserve(count);
+    
+    for(std::size_t i = 0; i < count; ++i) {
+        SPTAnimator animator {};
+        std::snprintf(animator._name, sizeof(animator._name), "Animator %zu", i);
+        
+        switch (i % 5) {
+            case 0:
+                animator.source.type = SPTAnimatorSourceTypePan;
+                animator.source.pan = SPTPanAnimatorSource {{0.f, 0.f}, {1.f, 1.f}, SPTPanAnimatorSourceAxisHorizontal};
+                break;
+            case 1:
+                animator.source.type = SPTAnimatorSourceTypeRandom;
+                animator.source.random = SPTRandomAnimatorSource {static_cast<uint32_t>(randomEngine()), frequencyDistribution(randomEngine)};
+                break;
+            case 2:
+                animator.source.type = SPTAnimatorSourceTypeNoise;
+                animator.source.noise = SPTNoiseAnimatorSource {SPTNoiseTypeValue, static_cast<uint32_t>(randomEngine()), frequencyDistribution(randomEngine), SPTEasingTypeSmoothStep};
+                break;
+            case 3:
+                animator.source.type = SPTAnimatorSourceTypeNoise;
+                animator.source.noise = SPTNoiseAnimatorSource {SPTNoiseTypePerlin, static_cast<uint32_t>(randomEngine()), frequencyDistribution(randomEngine), SPTEasingTypeSmoothStep};
+                break;
+            case 4:
+                animator.source.type = SPTAnimatorSourceTypeOscillator;
+                animator.source.oscillator = SPTOscillatorAnimatorSource {frequencyDistribution(randomEngine), SPTEasingTypeSmoothStep};
+                break;
+        }
+        
+        animatorIds.push_back(SPTAnimatorMake(animator));
+    }
+    
+    return animatorIds;
+}
+
+void bindAnimators(const std::vector<SPTObject>& objects, const std::vector<SPTAnimatorId>& animatorIds, std::size_t propertyCount, uint32_t seed) {
+    
+    if(objects.empty() || animatorIds.empty()) {
+        return;
+    }
+    
+    std::minstd_rand randomEngine {seed};
+    
+    // Each object property can be bound once, therefore going through all objects per property
+    const auto bindingCount = std::min(propertyCount, objects.size() * kTransformationProperties.size());
+    for(std::size_t i = 0; i < bindingCount; ++i) {
+        const auto& object = objects[i % objects.size()];
+        const auto property = kTransformationProperties[i / objects.size()];
+        const auto animatorId = animatorIds[randomEngine() % animatorIds.size()];
+        
+        switch (property) {
+            case SPTAnimatableObjectPropertyXYZScaleX:
+            case SPTAnimatableObjectPropertyXYZScaleY:
+            case SPTAnimatableObjectPropertyXYZScaleZ:
+                SPTObjectPropertyBindAnimator(property, object, SPTAnimatorBinding {animatorId, 0.5f, 1.5f});
+                break;
+            default:
+                SPTObjectPropertyBindAnimator(property, object, SPTAnimatorBinding {animatorId, -1.f, 1.f});
+                break;
+        }
+    }
+}
+
+}
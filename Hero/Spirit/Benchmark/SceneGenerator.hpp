@@ -0,0 +1,47 @@
+//
+//  SceneGenerator.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "Base.h"
+#include "Mesh.h"
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace spt::benchmark {
+
+enum class HierarchyShape {
+    deepChain,
+    wideFanOut,
+    randomForest
+};
+
+const char* toString(HierarchyShape shape);
+
+struct HierarchyDescriptor {
+    HierarchyShape shape;
+    std::size_t objectCount;
+    // Chain length for 'deepChain', children count per node for 'wideFanOut', roots ratio denominator for 'randomForest'
+    std::size_t branchParameter;
+    uint32_t seed;
+};
+
+// Makes objects with position, orientation and scale, parented according to the descriptor.
+// Returned objects are ordered so that parents precede their children
+std::vector<SPTObject> makeHierarchy(SPTHandle sceneHandle, const HierarchyDescriptor& descriptor);
+
+void makeRayCastableMeshLooks(const std::vector<SPTObject>& objects, SPTMeshId meshId);
+
+// Makes animators cycling through all source types
+std::vector<SPTAnimatorId> makeAnimators(std::size_t count, uint32_t seed);
+
+// Binds randomly picked animators to 'propertyCount' transformation properties spread over objects
+void bindAnimators(const std::vector<SPTObject>& objects, const std::vector<SPTAnimatorId>& animatorIds, std::size_t propertyCount, uint32_t seed);
+
+}
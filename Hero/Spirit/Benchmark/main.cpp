@@ -0,0 +1,410 @@
+//
+//  main.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+// Frame pipeline benchmark.
+// Usage: SpiritBenchmark [--shape chain|fanout|forest|all] [--objects N] [--branch B] [--animators N] [--bindings M]
+//                        [--frames F] [--dirty-fraction D] [--mesh path/to/mesh.obj] [--seed S] [--scaling-animators N]
+
+#include "SceneGenerator.hpp"
+#include "Scene.h"
+#include "Scene.hpp"
+#include "PlayableScene.h"
+#include "PlayableScene.hpp"
+#include "Position.h"
+#include "Camera.h"
+#include "RayCast.h"
+#include "Animator.h"
+#include "AnimatorEvaluator.hpp"
+#include "ResourceManager.h"
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// MARK: Allocation counting
+namespace {
+
+std::atomic<std::size_t> allocationCount {0};
+
+}
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if(auto ptr = std::malloc(size > 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+    if(auto ptr = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+
+// MARK: Cache miss counting
+namespace {
+
+// Last level cache misses of the calling thread, unavailable on other platforms
+// or when hardware counters are not accessible (e.g. restricted 'perf_event_paranoid')
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#if defined(__linux__)
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        _fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+    
+    ~CacheMissCounter() {
+#if defined(__linux__)
+        if(_fd >= 0) {
+            close(_fd);
+        }
+#endif
+    }
+    
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+    
+    bool isAvailable() const { return _fd >= 0; }
+    
+    void start() {
+#if defined(__linux__)
+        if(_fd >= 0) {
+            ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+    
+    uint64_t stop() {
+        uint64_t count = 0;
+#if defined(__linux__)
+        if(_fd >= 0) {
+            ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+            if(read(_fd, &count, sizeof(count)) != sizeof(count)) {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+    
+private:
+    int _fd = -1;
+};
+
+}
+
+namespace {
+
+using namespace spt::benchmark;
+
+struct Options {
+    std::vector<HierarchyShape> shapes {HierarchyShape::deepChain, HierarchyShape::wideFanOut, HierarchyShape::randomForest};
+    std::size_t objectCount = 10000;
+    std::size_t branchParameter = 0;
+    std::size_t animatorCount = 64;
+    std::size_t bindingCount = 10000;
+    std::size_t frameCount = 120;
+    double dirtyFraction = 0.1;
+    const char* meshPath = nullptr;
+    uint32_t seed = 1;
+    // Animators evaluated with increasing thread counts, zero to skip
+    std::size_t scalingAnimatorCount = 65536;
+};
+
+std::size_t defaultBranchParameter(HierarchyShape shape) {
+    switch (shape) {
+        case HierarchyShape::deepChain:
+            return 1000;
+        case HierarchyShape::wideFanOut:
+            return 1024;
+        case HierarchyShape::randomForest:
+            return 100;
+    }
+}
+
+struct PhaseResult {
+    double nsPerFrame;
+    double nsPerObject;
+    double allocationsPerFrame;
+    // Negative when cache miss counting is unavailable
+    double cacheMissesPerObject;
+};
+
+// Runs 'prepareFrame' untimed and then 'frame' timed for each frame
+template <typename PF, typename F>
+PhaseResult measure(std::size_t frameCount, std::size_t objectCount, PF prepareFrame, F frame) {
+    std::chrono::nanoseconds totalDuration {0};
+    std::size_t totalAllocationCount = 0;
+    uint64_t totalCacheMissCount = 0;
+    CacheMissCounter cacheMissCounter;
+
+    for(std::size_t i = 0; i < frameCount; ++i) {
+        prepareFrame(i);
+
+        const auto startAllocationCount = allocationCount.load(std::memory_order_relaxed);
+        cacheMissCounter.start();
+        const auto startTime = std::chrono::steady_clock::now();
+        frame(i);
+        totalDuration += std::chrono::steady_clock::now() - startTime;
+        totalCacheMissCount += cacheMissCounter.stop();
+        totalAllocationCount += allocationCount.load(std::memory_order_relaxed) - startAllocationCount;
+    }
+
+    const auto ns = static_cast<double>(totalDuration.count());
+    const auto objectFrameCount = static_cast<double>(frameCount * std::max<std::size_t>(objectCount, 1));
+    return PhaseResult {
+        ns / frameCount,
+        ns / objectFrameCount,
+        static_cast<double>(totalAllocationCount) / frameCount,
+        (cacheMissCounter.isAvailable() ? totalCacheMissCount / objectFrameCount : -1.0)
+    };
+}
+
+void printResult(const char* shapeName, const char* phase, const PhaseResult& result) {
+    char cacheMisses[16] = "n/a";
+    if(result.cacheMissesPerObject >= 0.0) {
+        std::snprintf(cacheMisses, sizeof(cacheMisses), "%.3f", result.cacheMissesPerObject);
+    }
+    std::printf("%-8s %-44s %14.0f %12.2f %14.2f %16s\n", shapeName, phase, result.nsPerFrame, result.nsPerObject, result.allocationsPerFrame, cacheMisses);
+}
+
+void printResult(HierarchyShape shape, const char* phase, const PhaseResult& result) {
+    printResult(toString(shape), phase, result);
+}
+
+void run(HierarchyShape shape, const Options& options) {
+
+    constexpr double kFrameDuration = 1.0 / 60.0;
+
+    const auto sceneHandle = SPTSceneMake();
+    auto& scene = *static_cast<spt::Scene*>(sceneHandle);
+
+    const auto cameraObject = SPTSceneMakeObject(sceneHandle);
+    SPTPositionMake(cameraObject, SPTPosition {SPTCoordinateSystemCartesian, .cartesian = {0.f, 0.f, 50.f}});
+    SPTCameraMakePerspective(cameraObject, M_PI_2, 1.f, 0.1f, 1000.f);
+
+    const auto objects = makeHierarchy(sceneHandle, HierarchyDescriptor {shape, options.objectCount, (options.branchParameter > 0 ? options.branchParameter : defaultBranchParameter(shape)), options.seed});
+
+    if(options.meshPath) {
+        makeRayCastableMeshLooks(objects, SPTCreate3DMeshFromFile(options.meshPath));
+    }
+
+    const auto animatorIds = makeAnimators(options.animatorCount, options.seed);
+    bindAnimators(objects, animatorIds, options.bindingCount, options.seed);
+
+    scene.update(0.0);
+
+    // Editing frames, 'dirtyFraction' of objects change position every frame
+    std::minstd_rand randomEngine {options.seed};
+    const auto dirtyCount = static_cast<std::size_t>(options.dirtyFraction * objects.size());
+    const auto makeDirty = [&objects, &randomEngine, dirtyCount] (std::size_t) {
+        for(std::size_t i = 0; i < dirtyCount; ++i) {
+            const auto& object = objects[randomEngine() % objects.size()];
+            auto position = SPTPositionGet(object);
+            position.cartesian.x += 0.01f;
+            SPTPositionUpdate(object, position);
+        }
+    };
+
+    printResult(shape, "Scene::update", measure(options.frameCount, objects.size(), makeDirty, [&scene] (std::size_t i) {
+        scene.update(i * kFrameDuration);
+    }));
+
+    printResult(shape, "Transformation::updateWithoutAnimators", measure(options.frameCount, objects.size(), makeDirty, [&scene] (std::size_t) {
+        scene.updateTransformations();
+    }));
+
+    if(options.meshPath) {
+        std::uniform_real_distribution<float> targetDistribution {-10.f, 10.f};
+        const SPTRay ray {{0.f, 0.f, 50.f}, {0.f, 0.f, -1.f}};
+        printResult(shape, "SPTRayCastScene", measure(options.frameCount, objects.size(), [] (std::size_t) {}, [sceneHandle, &ray, &randomEngine, &targetDistribution] (std::size_t) {
+            const simd_float3 target {targetDistribution(randomEngine), targetDistribution(randomEngine), 0.f};
+            SPTRayCastScene(sceneHandle, SPTRay {ray.origin, target - ray.origin}, 0.0001f);
+        }));
+    }
+
+    // Play frames
+    const SPTPlayableSceneDescriptor playableSceneDescriptor {cameraObject.entity, animatorIds.data(), static_cast<uint32_t>(animatorIds.size())};
+
+    // Includes destruction as scenes are entered and left in pairs
+    printResult(shape, "SPTPlayableSceneMake", measure(options.frameCount, objects.size(), [] (std::size_t) {}, [sceneHandle, &playableSceneDescriptor] (std::size_t) {
+        SPTPlayableSceneDestroy(SPTPlayableSceneMake(sceneHandle, playableSceneDescriptor));
+    }));
+
+    const auto playableSceneHandle = SPTPlayableSceneMake(sceneHandle, playableSceneDescriptor);
+    auto& playableScene = *static_cast<spt::PlayableScene*>(playableSceneHandle);
+
+    SPTAnimatorEvaluationContext context {};
+    context.samplingRate = 60;
+
+    printResult(shape, "PlayableScene::evaluateAnimators", measure(options.frameCount, objects.size(), [&context] (std::size_t i) {
+        context.time = i * kFrameDuration;
+        context.panLocation = simd_make_float2(0.5f + 0.5f * sinf(context.time), 0.5f);
+    }, [&playableScene, &context] (std::size_t) {
+        playableScene.evaluateAnimators(context);
+    }));
+
+    printResult(shape, "PlayableScene::update", measure(options.frameCount, objects.size(), [&playableScene, &context] (std::size_t i) {
+        context.time = i * kFrameDuration;
+        playableScene.evaluateAnimators(context);
+    }, [&playableScene] (std::size_t) {
+        playableScene.update();
+    }));
+
+    SPTPlayableSceneDestroy(playableSceneHandle);
+
+    for(const auto animatorId: animatorIds) {
+        SPTAnimatorDestroy(animatorId);
+    }
+
+    SPTSceneDestroy(sceneHandle);
+}
+
+// Animator evaluation with thread counts doubling up to the hardware concurrency, per object figures are per animator
+void runAnimatorScaling(const Options& options) {
+
+    constexpr double kFrameDuration = 1.0 / 60.0;
+
+    const auto animatorIds = makeAnimators(options.scalingAnimatorCount, options.seed);
+    const spt::AnimatorEvaluator evaluator {animatorIds};
+    std::vector<float> values (evaluator.valueCount());
+
+    SPTAnimatorEvaluationContext context {};
+    context.samplingRate = 60;
+
+    const std::size_t maxThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    for(std::size_t threadCount = 1;; threadCount = std::min(2 * threadCount, maxThreadCount)) {
+        // Calling thread is also a worker
+        spt::ThreadPool threadPool {threadCount - 1};
+
+        char phase[64];
+        std::snprintf(phase, sizeof(phase), "AnimatorEvaluator::evaluateParallel x%zu", threadCount);
+        printResult("-", phase, measure(options.frameCount, animatorIds.size(), [&context] (std::size_t i) {
+            context.time = i * kFrameDuration;
+        }, [&evaluator, &context, &values, &threadPool] (std::size_t) {
+            evaluator.evaluateParallel(context, values, threadPool);
+        }));
+
+        if(threadCount == maxThreadCount) {
+            break;
+        }
+    }
+
+    for(const auto animatorId: animatorIds) {
+        SPTAnimatorDestroy(animatorId);
+    }
+}
+
+bool parseOptions(int argc, const char* argv[], Options& options) {
+    for(int i = 1; i + 1 < argc; i += 2) {
+        const auto name = argv[i];
+        const auto value = argv[i + 1];
+        if(std::strcmp(name, "--shape") == 0) {
+            if(std::strcmp(value, "chain") == 0) {
+                options.shapes = {HierarchyShape::deepChain};
+            } else if(std::strcmp(value, "fanout") == 0) {
+                options.shapes = {HierarchyShape::wideFanOut};
+            } else if(std::strcmp(value, "forest") == 0) {
+                options.shapes = {HierarchyShape::randomForest};
+            } else if(std::strcmp(value, "all") != 0) {
+                return false;
+            }
+        } else if(std::strcmp(name, "--objects") == 0) {
+            options.objectCount = std::strtoull(value, nullptr, 10);
+        } else if(std::strcmp(name, "--branch") == 0) {
+            options.branchParameter = std::strtoull(value, nullptr, 10);
+        } else if(std::strcmp(name, "--animators") == 0) {
+            options.animatorCount = std::strtoull(value, nullptr, 10);
+        } else if(std::strcmp(name, "--bindings") == 0) {
+            options.bindingCount = std::strtoull(value, nullptr, 10);
+        } else if(std::strcmp(name, "--frames") == 0) {
+            options.frameCount = std::max<std::size_t>(std::strtoull(value, nullptr, 10), 1);
+        } else if(std::strcmp(name, "--dirty-fraction") == 0) {
+            options.dirtyFraction = std::strtod(value, nullptr);
+        } else if(std::strcmp(name, "--mesh") == 0) {
+            options.meshPath = value;
+        } else if(std::strcmp(name, "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        } else if(std::strcmp(name, "--scaling-animators") == 0) {
+            options.scalingAnimatorCount = std::strtoull(value, nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return argc % 2 == 1;
+}
+
+}
+
+int main(int argc, const char* argv[]) {
+
+    Options options;
+    if(!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--shape chain|fanout|forest|all] [--objects N] [--branch B] [--animators N] [--bindings M] [--frames F] [--dirty-fraction D] [--mesh path] [--seed S] [--scaling-animators N]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("objects: %zu, animators: %zu, bindings: %zu, frames: %zu\n\n", options.objectCount, options.animatorCount, options.bindingCount, options.frameCount);
+    std::printf("%-8s %-44s %14s %12s %14s %16s\n", "shape", "phase", "ns/frame", "ns/object", "allocs/frame", "misses/object");
+
+    for(const auto shape: options.shapes) {
+        run(shape, options);
+    }
+
+    if(options.scalingAnimatorCount > 0) {
+        runAnimatorScaling(options);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -46,7 +46,11 @@ simd_float4x4 computeViewportMatrix(simd_float2 screenSize) {
 namespace Camera {
 
 simd_float4x4 getViewMatrix(Registry& registry, SPTEntity entity) {
-    return simd_inverse(spt::Transformation::getGlobal(registry, entity));
+    const auto chainVersion = spt::Transformation::getChainVersion(registry, entity);
+    if(const auto viewMatrix = registry.try_get<ViewMatrix>(entity); viewMatrix && viewMatrix->chainVersion == chainVersion) {
+        return viewMatrix->float4x4;
+    }
+    return registry.emplace_or_replace<ViewMatrix>(entity, simd_inverse(spt::Transformation::getGlobal(registry, entity)), chainVersion).float4x4;
 }
 
 simd_float4x4 getProjectionMatrix(Registry& registry, SPTEntity entity) {
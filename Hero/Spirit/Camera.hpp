@@ -20,6 +20,12 @@ struct ProjectionMatrix {
     bool isDirty;
 };
 
+// Valid as long as the chain version of the camera transformation is unchanged
+struct ViewMatrix {
+    simd_float4x4 float4x4;
+    uint64_t chainVersion;
+};
+
 namespace Camera {
 
 simd_float4x4 getViewMatrix(Registry& registry, SPTEntity entity);
@@ -12,8 +12,14 @@
 
 #include <CoreFoundation/CoreFoundation.h>
 
+#elif defined(SPT_GHI_CPU)
+
+#include "HostObject_cpu.hpp"
+
 #endif
 
+#include <cassert>
+
 namespace spt::ghi {
 
 APIObjectWrapper::APIObjectWrapper(void* apiObject)
@@ -27,6 +33,8 @@ APIObjectWrapper::APIObjectWrapper(void* apiObject)
 APIObjectWrapper::~APIObjectWrapper() {
 #ifdef SPT_GHI_METAL
     CFRelease(_apiObject);
+#elif defined(SPT_GHI_CPU)
+    delete static_cast<HostObject*>(_apiObject);
 #endif
 }
 
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#ifdef __APPLE__
+#if defined(__APPLE__) && !defined(SPT_GHI_CPU)
 
 #define SPT_GHI_METAL
 
@@ -20,4 +20,20 @@ using Int = NSInteger;
 
 }
 
+#else
+
+// Host memory backend used for headless builds
+#ifndef SPT_GHI_CPU
+#define SPT_GHI_CPU
+#endif
+
+#include <cstddef>
+
+namespace spt::ghi {
+
+using UInt = std::size_t;
+using Int = std::ptrdiff_t;
+
+}
+
 #endif
@@ -0,0 +1,26 @@
+//
+//  Buffer_cpu.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "Buffer.hpp"
+
+#ifdef SPT_GHI_CPU
+
+#include "HostObject_cpu.hpp"
+
+namespace spt::ghi {
+
+void* Buffer::data() const {
+    return static_cast<HostBuffer*>(apiObject())->data();
+}
+
+UInt Buffer::size() const {
+    return static_cast<HostBuffer*>(apiObject())->length();
+}
+
+}
+
+#endif
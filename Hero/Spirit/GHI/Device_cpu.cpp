@@ -0,0 +1,29 @@
+//
+//  Device_cpu.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "Device.hpp"
+#include "Buffer.hpp"
+
+#ifdef SPT_GHI_CPU
+
+#include "HostObject_cpu.hpp"
+
+namespace spt::ghi {
+
+Device& Device::systemDefault() {
+    static Device device {new HostDevice{}};
+    return device;
+}
+
+Buffer* Device::newBuffer(const void* data, UInt length, StorageMode, CPUCacheMode, HazardTrackingMode) {
+    // Storage, cache and hazard tracking modes have no meaning for host memory
+    return new Buffer{new HostBuffer{data, length}};
+}
+
+}
+
+#endif
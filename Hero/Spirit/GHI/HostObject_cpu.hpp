@@ -0,0 +1,65 @@
+//
+//  HostObject_cpu.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "Base.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+
+namespace spt::ghi {
+
+// Backing object of 'APIObjectWrapper' for the host memory backend
+class HostObject {
+public:
+    HostObject() = default;
+    HostObject(const HostObject&) = delete;
+    HostObject& operator=(const HostObject&) = delete;
+    
+    virtual ~HostObject() = default;
+};
+
+class HostDevice: public HostObject {
+};
+
+class HostBuffer: public HostObject {
+public:
+    
+    // Matches cache line size so that buffers can be consumed by vectorized code
+    static constexpr UInt kAlignment = 64;
+    
+    HostBuffer(const void* data, UInt length)
+    : _length {length} {
+        // 'aligned_alloc' requires size to be a multiple of alignment
+        const auto allocationSize = (length + kAlignment - 1) / kAlignment * kAlignment;
+        _data = std::aligned_alloc(kAlignment, allocationSize > 0 ? allocationSize : kAlignment);
+        assert(_data);
+        if(data) {
+            std::memcpy(_data, data, length);
+        }
+    }
+    
+    ~HostBuffer() override {
+        std::free(_data);
+    }
+    
+    void* data() const {
+        return _data;
+    }
+    
+    UInt length() const {
+        return _length;
+    }
+    
+private:
+    void* _data;
+    UInt _length;
+};
+
+}
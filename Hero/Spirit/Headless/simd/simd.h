@@ -0,0 +1,313 @@
+//
+//  simd.h
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+// Portable subset of Apple's <simd/simd.h> used by Spirit core on non-Apple platforms.
+// Types match Apple's layout (3 component vectors occupy 16 bytes) so that structs shared with shaders keep their size.
+
+#pragma once
+
+#ifndef __cplusplus
+#error "Headless simd shim supports C++ translation units only"
+#endif
+
+#if !defined(__clang__)
+#error "Headless simd shim requires clang vector extensions"
+#endif
+
+#include <cmath>
+
+typedef float simd_float2 __attribute__((ext_vector_type(2)));
+typedef float simd_float3 __attribute__((ext_vector_type(3)));
+typedef float simd_float4 __attribute__((ext_vector_type(4)));
+
+typedef int simd_int2 __attribute__((ext_vector_type(2)));
+typedef int simd_int3 __attribute__((ext_vector_type(3)));
+typedef int simd_int4 __attribute__((ext_vector_type(4)));
+
+typedef struct { simd_float3 columns[3]; } simd_float3x3;
+typedef struct { simd_float4 columns[4]; } simd_float4x4;
+
+// Imaginary part in (x, y, z) and real part in w, as in Apple's layout
+typedef struct { simd_float4 vector; } simd_quatf;
+
+static const simd_float3x3 matrix_identity_float3x3 = {{
+    {1.f, 0.f, 0.f},
+    {0.f, 1.f, 0.f},
+    {0.f, 0.f, 1.f}
+}};
+
+static const simd_float4x4 matrix_identity_float4x4 = {{
+    {1.f, 0.f, 0.f, 0.f},
+    {0.f, 1.f, 0.f, 0.f},
+    {0.f, 0.f, 1.f, 0.f},
+    {0.f, 0.f, 0.f, 1.f}
+}};
+
+// MARK: Construction
+inline simd_float2 simd_make_float2(float x, float y) {
+    return simd_float2 {x, y};
+}
+
+inline simd_float3 simd_make_float3(float x, float y, float z) {
+    return simd_float3 {x, y, z};
+}
+
+inline simd_float3 simd_make_float3(simd_float2 xy, float z) {
+    return simd_float3 {xy.x, xy.y, z};
+}
+
+inline simd_float3 simd_make_float3(simd_float4 v) {
+    return v.xyz;
+}
+
+inline simd_float4 simd_make_float4(float x, float y, float z, float w) {
+    return simd_float4 {x, y, z, w};
+}
+
+inline simd_float4 simd_make_float4(simd_float3 xyz, float w) {
+    return simd_float4 {xyz.x, xyz.y, xyz.z, w};
+}
+
+inline simd_float4 simd_make_float4(simd_float3 xyz) {
+    return simd_float4 {xyz.x, xyz.y, xyz.z, 0.f};
+}
+
+// MARK: Common
+inline float simd_min(float x, float y) { return std::fmin(x, y); }
+inline simd_float2 simd_min(simd_float2 x, simd_float2 y) { return x < y ? x : y; }
+inline simd_float3 simd_min(simd_float3 x, simd_float3 y) { return x < y ? x : y; }
+inline simd_float4 simd_min(simd_float4 x, simd_float4 y) { return x < y ? x : y; }
+
+inline float simd_max(float x, float y) { return std::fmax(x, y); }
+inline simd_float2 simd_max(simd_float2 x, simd_float2 y) { return x > y ? x : y; }
+inline simd_float3 simd_max(simd_float3 x, simd_float3 y) { return x > y ? x : y; }
+inline simd_float4 simd_max(simd_float4 x, simd_float4 y) { return x > y ? x : y; }
+
+inline float simd_clamp(float x, float min, float max) { return simd_min(simd_max(x, min), max); }
+inline simd_float2 simd_clamp(simd_float2 x, simd_float2 min, simd_float2 max) { return simd_min(simd_max(x, min), max); }
+inline simd_float3 simd_clamp(simd_float3 x, simd_float3 min, simd_float3 max) { return simd_min(simd_max(x, min), max); }
+inline simd_float4 simd_clamp(simd_float4 x, simd_float4 min, simd_float4 max) { return simd_min(simd_max(x, min), max); }
+
+inline float simd_mix(float x, float y, float t) { return x + t * (y - x); }
+inline simd_float2 simd_mix(simd_float2 x, simd_float2 y, simd_float2 t) { return x + t * (y - x); }
+inline simd_float3 simd_mix(simd_float3 x, simd_float3 y, simd_float3 t) { return x + t * (y - x); }
+inline simd_float4 simd_mix(simd_float4 x, simd_float4 y, simd_float4 t) { return x + t * (y - x); }
+
+// MARK: Geometry
+inline float simd_dot(simd_float2 x, simd_float2 y) { return x.x * y.x + x.y * y.y; }
+inline float simd_dot(simd_float3 x, simd_float3 y) { return x.x * y.x + x.y * y.y + x.z * y.z; }
+inline float simd_dot(simd_float4 x, simd_float4 y) { return x.x * y.x + x.y * y.y + x.z * y.z + x.w * y.w; }
+
+inline float simd_length_squared(simd_float2 x) { return simd_dot(x, x); }
+inline float simd_length_squared(simd_float3 x) { return simd_dot(x, x); }
+inline float simd_length_squared(simd_float4 x) { return simd_dot(x, x); }
+
+inline float simd_length(simd_float2 x) { return std::sqrt(simd_length_squared(x)); }
+inline float simd_length(simd_float3 x) { return std::sqrt(simd_length_squared(x)); }
+inline float simd_length(simd_float4 x) { return std::sqrt(simd_length_squared(x)); }
+
+inline simd_float2 simd_normalize(simd_float2 x) { return x / simd_length(x); }
+inline simd_float3 simd_normalize(simd_float3 x) { return x / simd_length(x); }
+inline simd_float4 simd_normalize(simd_float4 x) { return x / simd_length(x); }
+
+inline simd_float3 simd_cross(simd_float3 x, simd_float3 y) {
+    return x.yzx * y.zxy - x.zxy * y.yzx;
+}
+
+// MARK: Comparison
+inline bool simd_equal(simd_float2 x, simd_float2 y) { return x.x == y.x && x.y == y.y; }
+inline bool simd_equal(simd_float3 x, simd_float3 y) { return x.x == y.x && x.y == y.y && x.z == y.z; }
+inline bool simd_equal(simd_float4 x, simd_float4 y) { return x.x == y.x && x.y == y.y && x.z == y.z && x.w == y.w; }
+
+inline bool simd_equal(simd_float3x3 x, simd_float3x3 y) {
+    return simd_equal(x.columns[0], y.columns[0]) && simd_equal(x.columns[1], y.columns[1]) && simd_equal(x.columns[2], y.columns[2]);
+}
+
+inline bool simd_equal(simd_float4x4 x, simd_float4x4 y) {
+    return simd_equal(x.columns[0], y.columns[0]) && simd_equal(x.columns[1], y.columns[1]) && simd_equal(x.columns[2], y.columns[2]) && simd_equal(x.columns[3], y.columns[3]);
+}
+
+// MARK: Matrix
+inline simd_float3 simd_mul(simd_float3x3 m, simd_float3 v) {
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z;
+}
+
+inline simd_float4 simd_mul(simd_float4x4 m, simd_float4 v) {
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z + m.columns[3] * v.w;
+}
+
+inline simd_float3x3 simd_mul(simd_float3x3 x, simd_float3x3 y) {
+    return simd_float3x3 {{
+        simd_mul(x, y.columns[0]),
+        simd_mul(x, y.columns[1]),
+        simd_mul(x, y.columns[2])
+    }};
+}
+
+inline simd_float4x4 simd_mul(simd_float4x4 x, simd_float4x4 y) {
+    return simd_float4x4 {{
+        simd_mul(x, y.columns[0]),
+        simd_mul(x, y.columns[1]),
+        simd_mul(x, y.columns[2]),
+        simd_mul(x, y.columns[3])
+    }};
+}
+
+inline simd_float3x3 simd_transpose(simd_float3x3 m) {
+    return simd_float3x3 {{
+        {m.columns[0].x, m.columns[1].x, m.columns[2].x},
+        {m.columns[0].y, m.columns[1].y, m.columns[2].y},
+        {m.columns[0].z, m.columns[1].z, m.columns[2].z}
+    }};
+}
+
+inline simd_float4x4 simd_transpose(simd_float4x4 m) {
+    return simd_float4x4 {{
+        {m.columns[0].x, m.columns[1].x, m.columns[2].x, m.columns[3].x},
+        {m.columns[0].y, m.columns[1].y, m.columns[2].y, m.columns[3].y},
+        {m.columns[0].z, m.columns[1].z, m.columns[2].z, m.columns[3].z},
+        {m.columns[0].w, m.columns[1].w, m.columns[2].w, m.columns[3].w}
+    }};
+}
+
+inline float simd_determinant(simd_float3x3 m) {
+    return simd_dot(m.columns[0], simd_cross(m.columns[1], m.columns[2]));
+}
+
+inline float simd_determinant(simd_float4x4 m) {
+    const auto& c = m.columns;
+    const float s0 = c[0].x * c[1].y - c[1].x * c[0].y;
+    const float s1 = c[0].x * c[1].z - c[1].x * c[0].z;
+    const float s2 = c[0].x * c[1].w - c[1].x * c[0].w;
+    const float s3 = c[0].y * c[1].z - c[1].y * c[0].z;
+    const float s4 = c[0].y * c[1].w - c[1].y * c[0].w;
+    const float s5 = c[0].z * c[1].w - c[1].z * c[0].w;
+    const float c5 = c[2].z * c[3].w - c[3].z * c[2].w;
+    const float c4 = c[2].y * c[3].w - c[3].y * c[2].w;
+    const float c3 = c[2].y * c[3].z - c[3].y * c[2].z;
+    const float c2 = c[2].x * c[3].w - c[3].x * c[2].w;
+    const float c1 = c[2].x * c[3].z - c[3].x * c[2].z;
+    const float c0 = c[2].x * c[3].y - c[3].x * c[2].y;
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+inline simd_float3x3 simd_inverse(simd_float3x3 m) {
+    // Rows of the inverse are cross products of the columns divided by the determinant
+    const auto r0 = simd_cross(m.columns[1], m.columns[2]);
+    const auto r1 = simd_cross(m.columns[2], m.columns[0]);
+    const auto r2 = simd_cross(m.columns[0], m.columns[1]);
+    const float invDet = 1.f / simd_dot(m.columns[0], r0);
+    return simd_transpose(simd_float3x3 {{r0 * invDet, r1 * invDet, r2 * invDet}});
+}
+
+inline simd_float4x4 simd_inverse(simd_float4x4 m) {
+    const auto& c = m.columns;
+    const float s0 = c[0].x * c[1].y - c[1].x * c[0].y;
+    const float s1 = c[0].x * c[1].z - c[1].x * c[0].z;
+    const float s2 = c[0].x * c[1].w - c[1].x * c[0].w;
+    const float s3 = c[0].y * c[1].z - c[1].y * c[0].z;
+    const float s4 = c[0].y * c[1].w - c[1].y * c[0].w;
+    const float s5 = c[0].z * c[1].w - c[1].z * c[0].w;
+    const float c5 = c[2].z * c[3].w - c[3].z * c[2].w;
+    const float c4 = c[2].y * c[3].w - c[3].y * c[2].w;
+    const float c3 = c[2].y * c[3].z - c[3].y * c[2].z;
+    const float c2 = c[2].x * c[3].w - c[3].x * c[2].w;
+    const float c1 = c[2].x * c[3].z - c[3].x * c[2].z;
+    const float c0 = c[2].x * c[3].y - c[3].x * c[2].y;
+    const float invDet = 1.f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    return simd_float4x4 {{
+        {
+            ( c[1].y * c5 - c[1].z * c4 + c[1].w * c3) * invDet,
+            (-c[0].y * c5 + c[0].z * c4 - c[0].w * c3) * invDet,
+            ( c[3].y * s5 - c[3].z * s4 + c[3].w * s3) * invDet,
+            (-c[2].y * s5 + c[2].z * s4 - c[2].w * s3) * invDet
+        },
+        {
+            (-c[1].x * c5 + c[1].z * c2 - c[1].w * c1) * invDet,
+            ( c[0].x * c5 - c[0].z * c2 + c[0].w * c1) * invDet,
+            (-c[3].x * s5 + c[3].z * s2 - c[3].w * s1) * invDet,
+            ( c[2].x * s5 - c[2].z * s2 + c[2].w * s1) * invDet
+        },
+        {
+            ( c[1].x * c4 - c[1].y * c2 + c[1].w * c0) * invDet,
+            (-c[0].x * c4 + c[0].y * c2 - c[0].w * c0) * invDet,
+            ( c[3].x * s4 - c[3].y * s2 + c[3].w * s0) * invDet,
+            (-c[2].x * s4 + c[2].y * s2 - c[2].w * s0) * invDet
+        },
+        {
+            (-c[1].x * c3 + c[1].y * c1 - c[1].z * c0) * invDet,
+            ( c[0].x * c3 - c[0].y * c1 + c[0].z * c0) * invDet,
+            (-c[3].x * s3 + c[3].y * s1 - c[3].z * s0) * invDet,
+            ( c[2].x * s3 - c[2].y * s1 + c[2].z * s0) * invDet
+        }
+    }};
+}
+
+// MARK: Quaternion
+inline simd_quatf simd_quaternion(simd_float4 xyzr) {
+    return simd_quatf {xyzr};
+}
+
+inline simd_quatf simd_quaternion(float ix, float iy, float iz, float r) {
+    return simd_quatf {simd_float4 {ix, iy, iz, r}};
+}
+
+inline simd_quatf simd_quaternion(simd_float3 imag, float real) {
+    return simd_quatf {simd_make_float4(imag, real)};
+}
+
+// 'axis' is expected to be normalized
+inline simd_quatf simd_quaternion(float angle, simd_float3 axis) {
+    return simd_quaternion(std::sin(0.5f * angle) * axis, std::cos(0.5f * angle));
+}
+
+// 'matrix' is expected to be a rotation
+inline simd_quatf simd_quaternion(simd_float3x3 matrix) {
+    const auto& m = matrix.columns;
+    const float trace = m[0][0] + m[1][1] + m[2][2];
+    if(trace >= 0.f) {
+        const float r = 2.f * std::sqrt(1.f + trace);
+        const float rInv = 1.f / r;
+        return simd_quaternion(rInv * (m[1][2] - m[2][1]), rInv * (m[2][0] - m[0][2]), rInv * (m[0][1] - m[1][0]), 0.25f * r);
+    } else if(m[0][0] >= m[1][1] && m[0][0] >= m[2][2]) {
+        const float r = 2.f * std::sqrt(1.f - m[1][1] - m[2][2] + m[0][0]);
+        const float rInv = 1.f / r;
+        return simd_quaternion(0.25f * r, rInv * (m[0][1] + m[1][0]), rInv * (m[0][2] + m[2][0]), rInv * (m[1][2] - m[2][1]));
+    } else if(m[1][1] >= m[2][2]) {
+        const float r = 2.f * std::sqrt(1.f - m[0][0] - m[2][2] + m[1][1]);
+        const float rInv = 1.f / r;
+        return simd_quaternion(rInv * (m[0][1] + m[1][0]), 0.25f * r, rInv * (m[1][2] + m[2][1]), rInv * (m[2][0] - m[0][2]));
+    } else {
+        const float r = 2.f * std::sqrt(1.f - m[0][0] - m[1][1] + m[2][2]);
+        const float rInv = 1.f / r;
+        return simd_quaternion(rInv * (m[0][2] + m[2][0]), rInv * (m[1][2] + m[2][1]), 0.25f * r, rInv * (m[0][1] - m[1][0]));
+    }
+}
+
+inline simd_float3 simd_imag(simd_quatf q) { return q.vector.xyz; }
+inline float simd_real(simd_quatf q) { return q.vector.w; }
+
+inline float simd_length(simd_quatf q) { return simd_length(q.vector); }
+inline simd_quatf simd_normalize(simd_quatf q) { return simd_quatf {simd_normalize(q.vector)}; }
+
+inline simd_quatf simd_mul(simd_quatf p, simd_quatf q) {
+    const auto pImag = simd_imag(p);
+    const auto qImag = simd_imag(q);
+    const auto pReal = simd_real(p);
+    const auto qReal = simd_real(q);
+    return simd_quaternion(pReal * qImag + qReal * pImag + simd_cross(pImag, qImag), pReal * qReal - simd_dot(pImag, qImag));
+}
+
+inline simd_float3x3 simd_matrix3x3(simd_quatf q) {
+    const auto v = q.vector;
+    return simd_float3x3 {{
+        {v.x * v.x - v.y * v.y - v.z * v.z + v.w * v.w, 2.f * (v.x * v.y + v.z * v.w), 2.f * (v.x * v.z - v.y * v.w)},
+        {2.f * (v.x * v.y - v.z * v.w), v.y * v.y - v.z * v.z + v.w * v.w - v.x * v.x, 2.f * (v.y * v.z + v.x * v.w)},
+        {2.f * (v.z * v.x + v.y * v.w), 2.f * (v.y * v.z - v.x * v.w), v.z * v.z + v.w * v.w - v.x * v.x - v.y * v.y}
+    }};
+}
@@ -46,12 +46,16 @@ void removeRenderableMaterial(SPTMeshShadingType shadingType, spt::Registry& reg
 }
 
 template <SPTAnimatableObjectProperty P>
-void updateRGBAChannel(spt::Registry& registry, const std::vector<float> animatorValues, size_t channelIndex) {
+void updateRGBAChannel(spt::Registry& registry, const std::vector<float>& boundValues, const std::vector<uint8_t>& boundValueChangeFlags, size_t channelIndex) {
     
     auto view = registry.view<spt::AnimatorBindingItem<P>, SPTMeshLook>();
-    view.each([&registry, &animatorValues, channelIndex] (auto entity, const auto& item, const auto& look) {
+    view.each([&registry, &boundValues, &boundValueChangeFlags, channelIndex] (auto entity, const auto& item, const auto& look) {
         
-        const auto value = spt::evaluateAnimatorBinding(item.base.binding, animatorValues[item.base.index]);
+        if(!boundValueChangeFlags[item.base.slot]) {
+            return;
+        }
+        
+        const auto value = boundValues[item.base.slot];
         
         switch (look.shading.type) {
             case SPTMeshShadingTypePlainColor: {
@@ -208,10 +212,15 @@ void MeshLook::update(spt::Registry& registry) {
     registry.clear<DirtyRenderableMaterialFlag>();
 }
 
-void MeshLook::updateWithOnlyAnimatorsChanging(spt::Registry& registry, const std::vector<float>& animatorValues) {
+void MeshLook::updateWithOnlyAnimatorsChanging(spt::Registry& registry, const std::vector<float>& boundValues, const std::vector<uint8_t>& boundValueChangeFlags) {
     
     auto hsbView = registry.view<spt::HSBColorAnimatorAnimatorRecord, SPTMeshLook>();
-    hsbView.each([&registry, &animatorValues] (auto entity, const auto& record, const auto& look) {
+    hsbView.each([&registry, &boundValues, &boundValueChangeFlags] (auto entity, const auto& record, const auto& look) {
+        
+        // Unbound channels refer to the reserved slot which is never flagged
+        if(!boundValueChangeFlags[record.hueItem.slot] && !boundValueChangeFlags[record.saturationItem.slot] && !boundValueChangeFlags[record.brightnessItem.slot]) {
+            return;
+        }
         
         SPTColor color;
         
@@ -226,16 +235,16 @@ void MeshLook::updateWithOnlyAnimatorsChanging(spt::Registry& registry, const st
             }
         }
         
-        if(record.hueItem.index != 0) {
-            color.hsba.hue = evaluateAnimatorBinding(record.hueItem.binding, animatorValues[record.hueItem.index]);
+        if(record.hueItem.slot != 0) {
+            color.hsba.hue = boundValues[record.hueItem.slot];
         }
 
-        if(record.saturationItem.index != 0) {
-            color.hsba.saturation = evaluateAnimatorBinding(record.saturationItem.binding, animatorValues[record.saturationItem.index]);
+        if(record.saturationItem.slot != 0) {
+            color.hsba.saturation = boundValues[record.saturationItem.slot];
         }
 
-        if(record.brightnessItem.index != 0) {
-            color.hsba.brightness = evaluateAnimatorBinding(record.brightnessItem.binding, animatorValues[record.brightnessItem.index]);
+        if(record.brightnessItem.slot != 0) {
+            color.hsba.brightness = boundValues[record.brightnessItem.slot];
         }
         
         switch (look.shading.type) {
@@ -251,18 +260,38 @@ void MeshLook::updateWithOnlyAnimatorsChanging(spt::Registry& registry, const st
         
     });
     
-    updateRGBAChannel<SPTAnimatableObjectPropertyRed>(registry, animatorValues, 0);
-    updateRGBAChannel<SPTAnimatableObjectPropertyGreen>(registry, animatorValues, 1);
-    updateRGBAChannel<SPTAnimatableObjectPropertyBlue>(registry, animatorValues, 2);
+    updateRGBAChannel<SPTAnimatableObjectPropertyRed>(registry, boundValues, boundValueChangeFlags, 0);
+    updateRGBAChannel<SPTAnimatableObjectPropertyGreen>(registry, boundValues, boundValueChangeFlags, 1);
+    updateRGBAChannel<SPTAnimatableObjectPropertyBlue>(registry, boundValues, boundValueChangeFlags, 2);
     
     auto shininessView = registry.view<spt::AnimatorBindingItem<SPTAnimatableObjectPropertyShininess>, SPTMeshLook>();
-    shininessView.each([&registry, &animatorValues] (auto entity, const auto& item, const auto& look) {
-        const auto value = spt::evaluateAnimatorBinding(item.base.binding, animatorValues[item.base.index]);
+    shininessView.each([&registry, &boundValues, &boundValueChangeFlags] (auto entity, const auto& item, const auto& look) {
+        if(!boundValueChangeFlags[item.base.slot]) {
+            return;
+        }
+        const auto value = boundValues[item.base.slot];
         registry.get<spt::PhongRenderableMaterial>(entity).shininess = value;
     });
     
 }
 
+void MeshLook::makeBatch(spt::Registry& registry, const SPTEntity* entities, const SPTMeshLook* meshLooks, std::size_t count) {
+    
+    auto& meshLookStorage = registry.storage<SPTMeshLook>();
+    meshLookStorage.reserve(meshLookStorage.size() + count);
+    auto& flagStorage = registry.storage<spt::DirtyRenderableMaterialFlag>();
+    flagStorage.reserve(flagStorage.size() + count);
+    
+    registry.insert<SPTMeshLook>(entities, entities + count, meshLooks);
+    
+    for(std::size_t i = 0; i < count; ++i) {
+        assert(SPTMeshShadingValidate(meshLooks[i].shading));
+        addRenderableMaterial(meshLooks[i].shading.type, registry, entities[i]);
+    }
+    
+    registry.insert<spt::DirtyRenderableMaterialFlag>(entities, entities + count);
+}
+
 void MeshLook::onDestroy(spt::Registry& registry, SPTEntity entity) {
     removeRenderableMaterial(registry.get<SPTMeshLook>(entity).shading.type, registry, entity);
     registry.remove<spt::DirtyRenderableMaterialFlag>(entity);
@@ -28,7 +28,11 @@ struct HSBColorAnimatorAnimatorRecord {
 namespace MeshLook {
 
 void update(spt::Registry& registry);
-void updateWithOnlyAnimatorsChanging(spt::Registry& registry, const std::vector<float>& animatorValues);
+// Bound channels are read from 'boundValues', only materials with a flagged bound channel are updated
+void updateWithOnlyAnimatorsChanging(spt::Registry& registry, const std::vector<float>& boundValues, const std::vector<uint8_t>& boundValueChangeFlags);
+
+// Counterpart of 'SPTMeshLookMake' for newly created entities which have no observers yet
+void makeBatch(spt::Registry& registry, const SPTEntity* entities, const SPTMeshLook* meshLooks, std::size_t count);
 
 void onDestroy(spt::Registry& registry, SPTEntity entity);
 
@@ -53,6 +53,9 @@ void SPTObjectPropertyBindAnimator(SPTAnimatableObjectProperty property, SPTObje
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::bindAnimator<SPTAnimatableObjectPropertyEulerOrientationZ>(object, animatorBinding);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::bindAnimator<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, animatorBinding);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::bindAnimator<SPTAnimatableObjectPropertyXYZScaleX>(object, animatorBinding);
         }
@@ -130,6 +133,9 @@ void SPTObjectPropertyUpdateAnimatorBinding(SPTAnimatableObjectProperty property
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::updateAnimatorBinding<SPTAnimatableObjectPropertyEulerOrientationZ>(object, animatorBinding);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::updateAnimatorBinding<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, animatorBinding);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::updateAnimatorBinding<SPTAnimatableObjectPropertyXYZScaleX>(object, animatorBinding);
         }
@@ -207,6 +213,9 @@ void SPTObjectPropertyUnbindAnimator(SPTAnimatableObjectProperty property, SPTOb
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::unbindAnimator<SPTAnimatableObjectPropertyEulerOrientationZ>(object);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::unbindAnimator<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::unbindAnimator<SPTAnimatableObjectPropertyXYZScaleX>(object);
         }
@@ -284,6 +293,9 @@ void SPTObjectPropertyUnbindAnimatorIfBound(SPTAnimatableObjectProperty property
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::unbindAnimatorIfBound<SPTAnimatableObjectPropertyEulerOrientationZ>(object);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::unbindAnimatorIfBound<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::unbindAnimatorIfBound<SPTAnimatableObjectPropertyXYZScaleX>(object);
         }
@@ -361,6 +373,9 @@ SPTAnimatorBinding SPTObjectPropertyGetAnimatorBinding(SPTAnimatableObjectProper
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::getAnimatorBinding<SPTAnimatableObjectPropertyEulerOrientationZ>(object);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::getAnimatorBinding<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::getAnimatorBinding<SPTAnimatableObjectPropertyXYZScaleX>(object);
         }
@@ -438,6 +453,9 @@ const SPTAnimatorBinding* _Nullable SPTObjectPropertyTryGetAnimatorBinding(SPTAn
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::tryGetAnimatorBinding<SPTAnimatableObjectPropertyEulerOrientationZ>(object);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::tryGetAnimatorBinding<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::tryGetAnimatorBinding<SPTAnimatableObjectPropertyXYZScaleX>(object);
         }
@@ -515,6 +533,9 @@ bool SPTObjectPropertyIsAnimatorBound(SPTAnimatableObjectProperty property, SPTO
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::isAnimatorBound<SPTAnimatableObjectPropertyEulerOrientationZ>(object);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::isAnimatorBound<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::isAnimatorBound<SPTAnimatableObjectPropertyXYZScaleX>(object);
         }
@@ -592,6 +613,9 @@ SPTObserverToken SPTObjectPropertyAddAnimatorBindingWillChangeObserver(SPTAnimat
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::addAnimatorBindingWillChangeObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, observer, userInfo);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::addAnimatorBindingWillChangeObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, observer, userInfo);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::addAnimatorBindingWillChangeObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, observer, userInfo);
         }
@@ -669,6 +693,9 @@ void SPTObjectPropertyRemoveAnimatorBindingWillChangeObserver(SPTAnimatableObjec
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::removeAnimatorBindingWillChangeObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, token);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::removeAnimatorBindingWillChangeObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, token);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::removeAnimatorBindingWillChangeObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, token);
         }
@@ -746,6 +773,9 @@ SPTObserverToken SPTObjectPropertyAddAnimatorBindingDidChangeObserver(SPTAnimata
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::addAnimatorBindingDidChangeObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, observer, userInfo);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::addAnimatorBindingDidChangeObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, observer, userInfo);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::addAnimatorBindingDidChangeObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, observer, userInfo);
         }
@@ -823,6 +853,9 @@ void SPTObjectPropertyRemoveAnimatorBindingDidChangeObserver(SPTAnimatableObject
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::removeAnimatorBindingDidChangeObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, token);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::removeAnimatorBindingDidChangeObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, token);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::removeAnimatorBindingDidChangeObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, token);
         }
@@ -900,6 +933,9 @@ SPTObserverToken SPTObjectPropertyAddAnimatorBindingDidEmergeObserver(SPTAnimata
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::addAnimatorBindingDidEmergeObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, observer, userInfo);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::addAnimatorBindingDidEmergeObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, observer, userInfo);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::addAnimatorBindingDidEmergeObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, observer, userInfo);
         }
@@ -977,6 +1013,9 @@ void SPTObjectPropertyRemoveAnimatorBindingDidEmergeObserver(SPTAnimatableObject
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::removeAnimatorBindingDidEmergeObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, token);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::removeAnimatorBindingDidEmergeObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, token);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::removeAnimatorBindingDidEmergeObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, token);
         }
@@ -1054,6 +1093,9 @@ SPTObserverToken SPTObjectPropertyAddAnimatorBindingWillPerishObserver(SPTAnimat
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::addAnimatorBindingWillPerishObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, observer, userInfo);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::addAnimatorBindingWillPerishObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, observer, userInfo);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::addAnimatorBindingWillPerishObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, observer, userInfo);
         }
@@ -1131,6 +1173,9 @@ void SPTObjectPropertyRemoveAnimatorBindingWillPerishObserver(SPTAnimatableObjec
         case SPTAnimatableObjectPropertyEulerOrientationZ: {
             return spt::removeAnimatorBindingWillPerishObserver<SPTAnimatableObjectPropertyEulerOrientationZ>(object, token);
         }
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle: {
+            return spt::removeAnimatorBindingWillPerishObserver<SPTAnimatableObjectPropertyQuaternionOrientationAngle>(object, token);
+        }
         case SPTAnimatableObjectPropertyXYZScaleX: {
             return spt::removeAnimatorBindingWillPerishObserver<SPTAnimatableObjectPropertyXYZScaleX>(object, token);
         }
@@ -11,6 +11,9 @@
 #include "AnimatorBinding.hpp"
 #include "AnimatableObjectProperty.h"
 
+#include <vector>
+#include <bit>
+#include <cstdint>
 
 namespace spt {
 
@@ -24,4 +27,48 @@ struct AnimatorBindingItem {
     AnimatorBindingItemBase base;
 };
 
+// Bindings of all properties of an object packed in property order, 'mask' has a bit per bound property.
+// Maintained along with 'AnimatorBinding<P>' components so that bindings of a scene are visited
+// in a single pass instead of a view per property
+struct ObjectAnimatorBindings {
+    
+    static_assert(SPTAnimatableObjectPropertyShininess < 32);
+    
+    void set(SPTAnimatableObjectProperty property, const SPTAnimatorBinding& binding) {
+        const auto bit = 1u << property;
+        const auto index = packedIndex(property);
+        if(mask & bit) {
+            bindings[index] = binding;
+        } else {
+            bindings.insert(bindings.begin() + index, binding);
+            mask |= bit;
+        }
+    }
+    
+    void erase(SPTAnimatableObjectProperty property) {
+        const auto bit = 1u << property;
+        if(mask & bit) {
+            bindings.erase(bindings.begin() + packedIndex(property));
+            mask &= ~bit;
+        }
+    }
+    
+    // Visits bindings in property order
+    template <typename F>
+    void forEach(F action) const {
+        auto remainingMask = mask;
+        for(const auto& binding: bindings) {
+            action(static_cast<SPTAnimatableObjectProperty>(std::countr_zero(remainingMask)), binding);
+            remainingMask &= remainingMask - 1;
+        }
+    }
+    
+    std::size_t packedIndex(SPTAnimatableObjectProperty property) const {
+        return std::popcount(mask & ((1u << property) - 1u));
+    }
+    
+    uint32_t mask = 0;
+    std::vector<SPTAnimatorBinding> bindings;
+};
+
 };
@@ -14,6 +14,14 @@
 
 namespace spt {
 
+inline void eraseObjectAnimatorBinding(Registry& registry, SPTEntity entity, SPTAnimatableObjectProperty property) {
+    auto& bindings = registry.get<ObjectAnimatorBindings>(entity);
+    bindings.erase(property);
+    if(bindings.mask == 0) {
+        registry.erase<ObjectAnimatorBindings>(entity);
+    }
+}
+
 template <SPTAnimatableObjectProperty P>
 void bindAnimator(SPTObject object, const SPTAnimatorBinding& animatorBinding) {
     auto& registry = Scene::getRegistry(object);
@@ -21,6 +29,7 @@ void bindAnimator(SPTObject object, const SPTAnimatorBinding& animatorBinding) {
     AnimatorBinding<P> comp {animatorBinding};
     
     registry.emplace<AnimatorBinding<P>>(object.entity, comp);
+    registry.get_or_emplace<ObjectAnimatorBindings>(object.entity).set(P, animatorBinding);
     
     spt::AnimatorManager::active().onObjectPropertyBind(animatorBinding.animatorId, object, P);
     
@@ -43,6 +52,7 @@ void updateAnimatorBinding(SPTObject object, const SPTAnimatorBinding& animatorB
     
     auto oldBinding = binding;
     binding = newBinding;
+    registry.get<ObjectAnimatorBindings>(object.entity).set(P, animatorBinding);
     
     if(animatorChanged) {
         spt::AnimatorManager::active().onObjectPropertyBind(animatorBinding.animatorId, object, P);
@@ -59,6 +69,7 @@ void unbindAnimator(SPTObject object) {
     const auto& animatorBinding = registry.get<AnimatorBinding<P>>(object.entity);
     spt::AnimatorManager::active().onObjectPropertyUnbind(animatorBinding.base.animatorId, object, P);
     registry.erase<AnimatorBinding<P>>(object.entity);
+    eraseObjectAnimatorBinding(registry, object.entity, P);
 }
 
 template <SPTAnimatableObjectProperty P>
@@ -73,6 +84,7 @@ void unbindAnimatorIfBound(SPTObject object) {
     const auto& animatorBinding = registry.get<AnimatorBinding<P>>(object.entity);
     spt::AnimatorManager::active().onObjectPropertyUnbind(animatorBinding.base.animatorId, object, P);
     registry.erase<AnimatorBinding<P>>(object.entity);
+    eraseObjectAnimatorBinding(registry, object.entity, P);
 }
 
 template <SPTAnimatableObjectProperty P>
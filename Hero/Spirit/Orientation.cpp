@@ -109,52 +109,94 @@ simd_float3x3 computeZXAxesMatrix(const SPTZXAxesOrientation& orientation) {
     };
 }
 
+simd_float3x3 getMatrix(const SPTOrientation& orientation, const simd_float3& position) {
+    switch (orientation.model) {
+        case SPTOrientationModelEulerXYZ: {
+            return SPTMatrix3x3CreateEulerXYZOrientation(orientation.euler);
+        }
+        case SPTOrientationModelEulerXZY: {
+            return SPTMatrix3x3CreateEulerXZYOrientation(orientation.euler);
+        }
+        case SPTOrientationModelEulerYXZ: {
+            return SPTMatrix3x3CreateEulerYXZOrientation(orientation.euler);
+        }
+        case SPTOrientationModelEulerYZX: {
+            return SPTMatrix3x3CreateEulerYZXOrientation(orientation.euler);
+        }
+        case SPTOrientationModelEulerZXY: {
+            return SPTMatrix3x3CreateEulerZXYOrientation(orientation.euler);
+        }
+        case SPTOrientationModelEulerZYX: {
+            return SPTMatrix3x3CreateEulerZYXOrientation(orientation.euler);
+        }
+        case SPTOrientationModelPointAtDirection: {
+            return SPTMatrix3x3CreateVectorToVector(SPTVectorGetPositiveDirection(orientation.pointAtDirection.axis), simd_normalize(orientation.pointAtDirection.direction));
+        }
+        case SPTOrientationModelLookAtPoint: {
+            return computeLookAtMatrix(position, orientation.lookAtPoint);
+        }
+        case SPTOrientationModelLookAtDirection: {
+            return computeLookAtDirectionMatrix(orientation.lookAtDirection);
+        }
+        case SPTOrientationModelXYAxis: {
+            return computeXYAxesMatrix(orientation.xyAxes);
+        }
+        case SPTOrientationModelYZAxis: {
+            return computeYZAxesMatrix(orientation.yzAxes);
+        }
+        case SPTOrientationModelZXAxis: {
+            return computeZXAxesMatrix(orientation.zxAxes);
+        }
+        case SPTOrientationModelQuaternion: {
+            return simd_matrix3x3(orientation.quaternion);
+        }
+    }
+}
+
 simd_float3x3 getMatrix(const spt::Registry& registry, SPTEntity entity, const simd_float3& position) {
     
     if(const auto orientation = registry.try_get<SPTOrientation>(entity)) {
-        switch (orientation->model) {
-            case SPTOrientationModelEulerXYZ: {
-                return SPTMatrix3x3CreateEulerXYZOrientation(orientation->euler);
-            }
-            case SPTOrientationModelEulerXZY: {
-                return SPTMatrix3x3CreateEulerXZYOrientation(orientation->euler);
-            }
-            case SPTOrientationModelEulerYXZ: {
-                return SPTMatrix3x3CreateEulerYXZOrientation(orientation->euler);
-            }
-            case SPTOrientationModelEulerYZX: {
-                return SPTMatrix3x3CreateEulerYZXOrientation(orientation->euler);
-            }
-            case SPTOrientationModelEulerZXY: {
-                return SPTMatrix3x3CreateEulerZXYOrientation(orientation->euler);
-            }
-            case SPTOrientationModelEulerZYX: {
-                return SPTMatrix3x3CreateEulerZYXOrientation(orientation->euler);
-            }
-            case SPTOrientationModelPointAtDirection: {
-                return SPTMatrix3x3CreateVectorToVector(SPTVectorGetPositiveDirection(orientation->pointAtDirection.axis), simd_normalize(orientation->pointAtDirection.direction));
-            }
-            case SPTOrientationModelLookAtPoint: {
-                return computeLookAtMatrix(position, orientation->lookAtPoint);
-            }
-            case SPTOrientationModelLookAtDirection: {
-                return computeLookAtDirectionMatrix(orientation->lookAtDirection);
-            }
-            case SPTOrientationModelXYAxis: {
-                return computeXYAxesMatrix(orientation->xyAxes);
-            }
-            case SPTOrientationModelYZAxis: {
-                return computeYZAxesMatrix(orientation->yzAxes);
-            }
-            case SPTOrientationModelZXAxis: {
-                return computeZXAxesMatrix(orientation->zxAxes);
-            }
-        }
+        return getMatrix(*orientation, position);
     }
-    
     return matrix_identity_float3x3;
 }
 
+simd_float3 getQuaternionAnimationAxis(simd_quatf quaternion) {
+    const auto imag = simd_imag(quaternion);
+    const auto lengthSquared = simd_length_squared(imag);
+    if(lengthSquared < 1e-12f) {
+        return simd_float3 {0.f, 0.f, 1.f};
+    }
+    // Keep rotation direction consistent for both representations of the same orientation
+    return (simd_real(quaternion) < 0.f ? -1.f : 1.f) * imag / sqrtf(lengthSquared);
+}
+
+QuaternionSlerp makeQuaternionSlerp(simd_quatf from, simd_quatf to) {
+    auto cosAngle = simd_dot(from.vector, to.vector);
+    // Take the shortest arc
+    if(cosAngle < 0.f) {
+        to.vector = -to.vector;
+        cosAngle = -cosAngle;
+    }
+    
+    if(cosAngle > 0.9995f) {
+        return QuaternionSlerp {from, to, 0.f, 0.f};
+    }
+    
+    const auto angle = acosf(cosAngle);
+    return QuaternionSlerp {from, to, angle, 1.f / sinf(angle)};
+}
+
+void evaluateQuaternionSlerpWeights(const float* t, const float* angles, const float* inverseSinAngles, float* fromWeights, float* toWeights, std::size_t count) {
+    for(std::size_t i = 0; i < count; ++i) {
+        const auto isLinear = (angles[i] == 0.f);
+        const auto fromSlerpWeight = sinf((1.f - t[i]) * angles[i]) * inverseSinAngles[i];
+        const auto toSlerpWeight = sinf(t[i] * angles[i]) * inverseSinAngles[i];
+        fromWeights[i] = isLinear ? 1.f - t[i] : fromSlerpWeight;
+        toWeights[i] = isLinear ? t[i] : toSlerpWeight;
+    }
+}
+
 }
 
 bool SPTPointAtDirectionOrientationEqual(SPTPointAtDirectionOrientation lhs, SPTPointAtDirectionOrientation rhs) {
@@ -212,12 +254,14 @@ bool SPTOrientationEqual(SPTOrientation lhs, SPTOrientation rhs) {
             return SPTYZAxesOrientationEqual(lhs.yzAxes, rhs.yzAxes);
         case SPTOrientationModelZXAxis:
             return SPTZXAxesOrientationEqual(lhs.zxAxes, rhs.zxAxes);
+        case SPTOrientationModelQuaternion:
+            return simd_equal(lhs.quaternion.vector, rhs.quaternion.vector);
     }
 }
 
 void SPTOrientationMake(SPTObject object, SPTOrientation orientation) {
     auto& registry = spt::Scene::getRegistry(object);
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    spt::Transformation::markDirty(registry, object.entity);
     registry.emplace<SPTOrientation>(object.entity, orientation);
     spt::notifyComponentDidEmergeObservers(registry, object.entity, orientation);
 }
@@ -225,7 +269,7 @@ void SPTOrientationMake(SPTObject object, SPTOrientation orientation) {
 void SPTOrientationUpdate(SPTObject object, SPTOrientation newOrientation) {
     auto& registry = spt::Scene::getRegistry(object);
     spt::notifyComponentWillChangeObservers(registry, object.entity, newOrientation);
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    spt::Transformation::markDirty(registry, object.entity);
     spt::notifyComponentDidChangeObservers(registry, object.entity, spt::update(registry, object.entity, newOrientation));
 }
 
@@ -264,13 +308,27 @@ simd_float3x3 SPTOrientationGetMatrix(SPTOrientation orientation) {
             return SPTMatrix3x3CreateEulerZYXOrientation(orientation.euler);
         case SPTOrientationModelPointAtDirection:
             return SPTMatrix3x3CreateVectorToVector(SPTVectorGetPositiveDirection(orientation.pointAtDirection.axis), simd_normalize(orientation.pointAtDirection.direction));
-        default:
-            // TODO
+        case SPTOrientationModelLookAtDirection:
+            return spt::Orientation::computeLookAtDirectionMatrix(orientation.lookAtDirection);
+        case SPTOrientationModelXYAxis:
+            return spt::Orientation::computeXYAxesMatrix(orientation.xyAxes);
+        case SPTOrientationModelYZAxis:
+            return spt::Orientation::computeYZAxesMatrix(orientation.yzAxes);
+        case SPTOrientationModelZXAxis:
+            return spt::Orientation::computeZXAxesMatrix(orientation.zxAxes);
+        case SPTOrientationModelQuaternion:
+            return simd_matrix3x3(orientation.quaternion);
+        case SPTOrientationModelLookAtPoint:
+            // Depends on the object position, see 'SPTOrientationGetMatrixAtPosition'
             assert(false);
             return matrix_identity_float3x3;
     }
 }
 
+simd_float3x3 SPTOrientationGetMatrixAtPosition(SPTOrientation orientation, simd_float3 position) {
+    return spt::Orientation::getMatrix(orientation, position);
+}
+
 SPTOrientation SPTOrientationToEulerXYZ(SPTOrientation orientation) {
     return {SPTOrientationModelEulerXYZ, .euler = SPTMatrix3x3GetEulerXYZOrientationAngles(SPTOrientationGetMatrix(orientation))};
 }
@@ -318,6 +376,13 @@ SPTOrientation SPTOrientationToPointAtDirection(SPTOrientation orientation, SPTA
     return {.model = SPTOrientationModelPointAtDirection, .pointAtDirection = pointAtDirection};
 }
 
+SPTOrientation SPTOrientationToQuaternion(SPTOrientation orientation, simd_float3 position) {
+    if(orientation.model == SPTOrientationModelQuaternion) {
+        return orientation;
+    }
+    return {.model = SPTOrientationModelQuaternion, .quaternion = simd_quaternion(spt::Orientation::getMatrix(orientation, position))};
+}
+
 SPTObserverToken SPTOrientationAddWillChangeObserver(SPTObject object, SPTOrientationWillChangeObserver observer, SPTObserverUserInfo userInfo) {
     return spt::addComponentWillChangeObserver<SPTOrientation>(object, observer, userInfo);
 }
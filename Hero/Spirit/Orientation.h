@@ -28,6 +28,7 @@ typedef enum {
     SPTOrientationModelXYAxis,
     SPTOrientationModelYZAxis,
     SPTOrientationModelZXAxis,
+    SPTOrientationModelQuaternion,
 } __attribute__((enum_extensibility(closed))) SPTOrientationModel;
 
 typedef struct {
@@ -90,6 +91,8 @@ typedef struct {
         SPTXYAxesOrientation xyAxes;
         SPTYZAxesOrientation yzAxes;
         SPTZXAxesOrientation zxAxes;
+        // Unit quaternion
+        simd_quatf quaternion;
     };
 } SPTOrientation;
 
@@ -107,8 +110,11 @@ const SPTOrientation* _Nullable SPTOrientationTryGet(SPTObject object);
 
 bool SPTOrientationExists(SPTObject object);
 
+// Look at point orientation is not supported as it depends on the object position
 simd_float3x3 SPTOrientationGetMatrix(SPTOrientation orientation);
 
+simd_float3x3 SPTOrientationGetMatrixAtPosition(SPTOrientation orientation, simd_float3 position);
+
 SPTOrientation SPTOrientationToEulerXYZ(SPTOrientation orientation);
 SPTOrientation SPTOrientationToEulerXZY(SPTOrientation orientation);
 SPTOrientation SPTOrientationToEulerYXZ(SPTOrientation orientation);
@@ -118,6 +124,9 @@ SPTOrientation SPTOrientationToEulerZYX(SPTOrientation orientation);
 
 SPTOrientation SPTOrientationToPointAtDirection(SPTOrientation orientation, SPTAxis axis, float directionLength);
 
+// Supports all models, 'position' is the object position used by look at point orientation
+SPTOrientation SPTOrientationToQuaternion(SPTOrientation orientation, simd_float3 position);
+
 typedef void (* _Nonnull SPTOrientationWillChangeObserver) (SPTOrientation, SPTObserverUserInfo);
 SPTObserverToken SPTOrientationAddWillChangeObserver(SPTObject object, SPTOrientationWillChangeObserver observer, SPTObserverUserInfo userInfo);
 void SPTOrientationRemoveWillChangeObserver(SPTObject object, SPTObserverToken token);
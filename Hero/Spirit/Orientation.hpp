@@ -10,11 +10,34 @@
 #include "Base.hpp"
 #include "Orientation.h"
 
+#include <cstddef>
+
 
 namespace spt::Orientation {
 
 simd_float3x3 computeLookAtMatrix(simd_float3 pos, const SPTLookAtPointOrientation& lookAtOrientation);
 
+simd_float3x3 getMatrix(const SPTOrientation& orientation, const simd_float3& position);
+
 simd_float3x3 getMatrix(const spt::Registry& registry, SPTEntity entity, const simd_float3& position);
 
+// Axis that quaternion angle animator binding rotates around, z axis for the identity
+simd_float3 getQuaternionAnimationAxis(simd_quatf quaternion);
+
+// Spherical interpolation with the arc evaluated once per quaternion pair so that
+// each evaluation costs two sines, nearby quaternions are interpolated linearly and normalized
+struct QuaternionSlerp {
+    simd_quatf from;
+    simd_quatf to;
+    float angle;
+    float inverseSinAngle;
+};
+
+QuaternionSlerp makeQuaternionSlerp(simd_quatf from, simd_quatf to);
+
+// Weights of 'from' and 'to' quaternions of 'count' interpolations given in parallel arrays,
+// the blend is normalized afterwards. Zero angles get linear weights without branching,
+// hence all weights are computed in a single vectorizable loop
+void evaluateQuaternionSlerpWeights(const float* t, const float* angles, const float* inverseSinAngles, float* fromWeights, float* toWeights, std::size_t count);
+
 }
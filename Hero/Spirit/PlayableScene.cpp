@@ -18,354 +18,387 @@
 #include "AnimatorManager.hpp"
 #include "ObjectPropertyAnimatorBinding.hpp"
 #include "Matrix.h"
+#include "ThreadPool.hpp"
 
 #include <entt/entt.hpp>
+#include <algorithm>
+#include <limits>
 
 
 namespace spt {
 
-PlayableScene::PlayableScene(const Scene& scene, const SPTPlayableSceneDescriptor& descriptor)
-: _transformationGroup {registry.group<Transformation::AnimatorRecord, Transformation>()} {
+namespace {
+
+template <typename... Cs>
+void cloneComponents(const Registry& source, Registry& destination, SPTEntity entity) {
+    ([&source, &destination, entity] {
+        if(const auto component = source.try_get<Cs>(entity)) {
+            destination.emplace<Cs>(entity, *component);
+        }
+    }(), ...);
+}
+
+// Animators are unbound from objects when destroyed, hence entity indices identify them unambiguously
+uint32_t getAnimatorValueIndex(const std::vector<uint32_t>& animatorValueIndices, SPTAnimatorId animatorId) {
+    const auto index = entt::to_entity(animatorId);
+    return index < animatorValueIndices.size() ? animatorValueIndices[index] : 0;
+}
+
+AnimatorBindingItemBase* getTransformationBindingItem(Transformation::AnimatorRecord& record, SPTAnimatableObjectProperty property) {
+    switch (property) {
+        case SPTAnimatableObjectPropertyCartesianPositionX:
+            return &record.positionRecord.cartesian.x;
+        case SPTAnimatableObjectPropertyCartesianPositionY:
+            return &record.positionRecord.cartesian.y;
+        case SPTAnimatableObjectPropertyCartesianPositionZ:
+            return &record.positionRecord.cartesian.z;
+        case SPTAnimatableObjectPropertyLinearPositionOffset:
+            return &record.positionRecord.linear.offset;
+        case SPTAnimatableObjectPropertySphericalPositionRadius:
+            return &record.positionRecord.spherical.radius;
+        case SPTAnimatableObjectPropertySphericalPositionLongitude:
+            return &record.positionRecord.spherical.longitude;
+        case SPTAnimatableObjectPropertySphericalPositionLatitude:
+            return &record.positionRecord.spherical.latitude;
+        case SPTAnimatableObjectPropertyCylindricalPositionRadius:
+            return &record.positionRecord.cylindrical.radius;
+        case SPTAnimatableObjectPropertyCylindricalPositionLongitude:
+            return &record.positionRecord.cylindrical.longitude;
+        case SPTAnimatableObjectPropertyCylindricalPositionHeight:
+            return &record.positionRecord.cylindrical.height;
+        case SPTAnimatableObjectPropertyEulerOrientationX:
+            return &record.orientationRecord.euler.x;
+        case SPTAnimatableObjectPropertyEulerOrientationY:
+            return &record.orientationRecord.euler.y;
+        case SPTAnimatableObjectPropertyEulerOrientationZ:
+            return &record.orientationRecord.euler.z;
+        case SPTAnimatableObjectPropertyQuaternionOrientationAngle:
+            return &record.orientationRecord.quaternion.angle;
+        case SPTAnimatableObjectPropertyXYZScaleX:
+            return &record.scaleRecord.xyz.x;
+        case SPTAnimatableObjectPropertyXYZScaleY:
+            return &record.scaleRecord.xyz.y;
+        case SPTAnimatableObjectPropertyXYZScaleZ:
+            return &record.scaleRecord.xyz.z;
+        case SPTAnimatableObjectPropertyUniformScale:
+            return &record.scaleRecord.uniform;
+        default:
+            return nullptr;
+    }
+}
+
+SPTColorModel getColorModel(const SPTMeshLook& look) {
+    switch(look.shading.type) {
+        case SPTMeshShadingTypeBlinnPhong:
+            return look.shading.blinnPhong.color.model;
+        case SPTMeshShadingTypePlainColor:
+            return look.shading.plainColor.color.model;
+    }
+}
+
+}
+
+PlayableScene::PlayableScene(Scene& scene, const SPTPlayableSceneDescriptor& descriptor)
+: _sharedScene {scene}
+, _transformationGroup {registry.group<Transformation::AnimatorRecord, Transformation>()} {
     
-    cloneEntities(scene, descriptor);
+    _sharedScene.freeze();
     
     // Prepare animators
-    std::unordered_map<SPTAnimatorId, size_t> animatorIdToValueIndex;
     const auto& animatorManager = spt::AnimatorManager::active();
     
+    std::vector<SPTAnimatorId> animatorIds;
     if(descriptor.animatorsSize > 0) {
-        _animatorIds = std::vector<SPTAnimatorId>{descriptor.animatorIds, descriptor.animatorIds + descriptor.animatorsSize};
+        animatorIds = std::vector<SPTAnimatorId>{descriptor.animatorIds, descriptor.animatorIds + descriptor.animatorsSize};
     } else {
         const auto& span = animatorManager.animatorIds();
-        _animatorIds = std::vector<SPTAnimatorId>{span.begin(), span.end()};
+        animatorIds = std::vector<SPTAnimatorId>{span.begin(), span.end()};
     }
     
-    for(size_t i = 0; i < _animatorIds.size(); ++i) {
-        animatorIdToValueIndex[_animatorIds[i]] = i + 1;
+    _animatorEvaluator = AnimatorEvaluator {animatorIds};
+    
+    // Dense table instead of a map as animator identifiers are entity identifiers
+    std::vector<uint32_t> animatorValueIndices;
+    for(size_t i = 0; i < animatorIds.size(); ++i) {
+        const auto index = entt::to_entity(animatorIds[i]);
+        if(index >= animatorValueIndices.size()) {
+            animatorValueIndices.resize(index + 1, 0);
+        }
+        animatorValueIndices[index] = static_cast<uint32_t>(_animatorEvaluator.valueIndex(i));
     }
-    _animatorValues.assign(_animatorIds.size() + 1, 0.f);
+    // NaN differs from any value, hence everything is updated on the first frame
+    _animatorValues.assign(_animatorEvaluator.valueCount(), std::numeric_limits<float>::quiet_NaN());
+    _previousAnimatorValues = _animatorValues;
+    _animatorValueChangeFlags.assign(_animatorEvaluator.valueCount(), false);
     
-    prepareTransformationAnimations(scene, animatorIdToValueIndex);
+    const auto animatedEntities = collectAnimatedEntities(scene, animatorValueIndices);
+    cloneAnimatedEntities(scene, descriptor, animatedEntities);
     
-    prepareMeshLookAnimations(scene, animatorIdToValueIndex);
+    prepareAnimations(scene, animatedEntities, animatorValueIndices);
+    _transformationAnimatorsPartitions = Transformation::partitionAnimators(_transformationGroup);
+    
+    _animatorBindingEvaluator.sortBindings();
+    _boundValues.assign(_animatorBindingEvaluator.slotCount(), 0.f);
+    _boundValueChangeFlags.assign(_animatorBindingEvaluator.slotCount(), false);
 }
 
-void PlayableScene::evaluateAnimators(const SPTAnimatorEvaluationContext& context) {
-    size_t i = 1;
-    for(auto& animatorId: _animatorIds) {
-        _animatorValues[i++] = spt::AnimatorManager::active().evaluate(animatorId, context);
-    }
+PlayableScene::~PlayableScene() {
+    _sharedScene.unfreeze();
 }
 
-void PlayableScene::update() {
-    Transformation::updateWithOnlyAnimatorsChanging(registry, _transformationGroup, _animatorValues);
-    MeshLook::updateWithOnlyAnimatorsChanging(registry, _animatorValues);
+const Registry& PlayableScene::sharedRegistry() const {
+    return _sharedScene.registry;
 }
 
-void PlayableScene::cloneEntities(const Scene& scene, const SPTPlayableSceneDescriptor& descriptor) {
-    
-    // Clone entities
-    registry.assign(scene.registry.data(), scene.registry.data() + scene.registry.size(), scene.registry.released());
+void PlayableScene::evaluateAnimators(const SPTAnimatorEvaluationContext& context) {
     
-    // Clone transformations
-    auto sourceTransView = scene.registry.view<spt::Transformation>();
-    if(!sourceTransView.empty()) {
-        registry.insert<spt::Transformation>(sourceTransView.data(), sourceTransView.data() + sourceTransView.size(), *sourceTransView.raw());
-    }
+    // All values are overwritten, hence the previous ones are kept by swapping
+    _animatorValues.swap(_previousAnimatorValues);
     
-    // Clone positions
-    auto sourcePositionView = scene.registry.view<SPTPosition>();
-    if(!sourcePositionView.empty()) {
-        registry.insert<SPTPosition>(sourcePositionView.data(), sourcePositionView.data() + sourcePositionView.size(), *sourcePositionView.raw());
+    if(_animatorCurveCache) {
+        const auto timeValueBegin = _animatorEvaluator.timeValueBegin();
+        _animatorEvaluator.evaluate(context, _animatorValues.data(), 1, timeValueBegin);
+        _animatorCurveCache->read(context.time, _animatorValues.data() + timeValueBegin);
+    } else if(_animatorValues.size() >= AnimatorEvaluator::kParallelizationThreshold) {
+        _animatorEvaluator.evaluateParallel(context, _animatorValues, ThreadPool::active());
+    } else {
+        _animatorEvaluator.evaluate(context, _animatorValues);
     }
     
-    // Clone orientations
-    auto sourceOrientationView = scene.registry.view<SPTOrientation>();
-    if(!sourceOrientationView.empty()) {
-        registry.insert<SPTOrientation>(sourceOrientationView.data(), sourceOrientationView.data() + sourceOrientationView.size(), *sourceOrientationView.raw());
+    // Static animators such as pan without a touch, oscillators with zero frequency
+    // or random ones within a period keep their values and are skipped by 'update'.
+    // Flags accumulate until consumed by 'update'
+    for(std::size_t i = 1; i < _animatorValues.size(); ++i) {
+        _animatorValueChangeFlags[i] |= (_animatorValues[i] != _previousAnimatorValues[i]);
     }
-    
-    // Clone scales
-    auto sourceScaleView = scene.registry.view<SPTScale>();
-    if(!sourceScaleView.empty()) {
-        registry.insert<SPTScale>(sourceScaleView.data(), sourceScaleView.data() + sourceScaleView.size(), *sourceScaleView.raw());
+}
+
+void PlayableScene::update() {
+    // Changes of shared objects mark them dirty, the frozen scene does not update itself
+    if(!_sharedScene.registry.storage<DirtyTransformationFlag>().empty() || !_sharedScene.registry.storage<DirtyRenderableMaterialFlag>().empty()) {
+        updateSharedObjects();
     }
     
-    // Clone mesh looks
-    auto sourceMeshLooks = scene.registry.view<SPTMeshLook>();
-    if(!sourceMeshLooks.empty()) {
-        registry.insert<SPTMeshLook>(sourceMeshLooks.data(), sourceMeshLooks.data() + sourceMeshLooks.size(), *sourceMeshLooks.raw());
+    _animatorBindingEvaluator.evaluate(_animatorValues, _animatorValueChangeFlags, _boundValues, _boundValueChangeFlags);
+    std::fill(_animatorValueChangeFlags.begin(), _animatorValueChangeFlags.end(), false);
+    Transformation::updateWithOnlyAnimatorsChanging(registry, _transformationGroup, _transformationAnimatorsPartitions, _transformationHierarchy, _boundValues, _boundValueChangeFlags);
+    MeshLook::updateWithOnlyAnimatorsChanging(registry, _boundValues, _boundValueChangeFlags);
+}
+
+void PlayableScene::updateSharedObjects() {
+    _sharedScene.updateTransformations();
+    _sharedScene.updateLooks();
+    
+    for(const auto& [entity, local]: _sharedParentChildren) {
+        const auto sharedParentGlobal = getSharedParentGlobal(_sharedScene, entity);
+        if(auto animRecord = registry.try_get<Transformation::AnimatorRecord>(entity)) {
+            animRecord->sharedParentGlobal = sharedParentGlobal;
+        } else {
+            _transformationHierarchy.setLocal(registry.get<spt::Transformation>(entity), multiply(sharedParentGlobal, local));
+        }
     }
     
-    // Clone renderable materials
-    auto sourcePhongRenderableMaterial = scene.registry.view<PhongRenderableMaterial>();
-    if(!sourcePhongRenderableMaterial.empty()) {
-        registry.insert<PhongRenderableMaterial>(sourcePhongRenderableMaterial.data(), sourcePhongRenderableMaterial.data() + sourcePhongRenderableMaterial.size(), *sourcePhongRenderableMaterial.raw());
-    }
+    // Animated transformations are recomputed with the new shared parent globals
+    std::fill(_animatorValueChangeFlags.begin() + 1, _animatorValueChangeFlags.end(), true);
+}
+
+void PlayableScene::bakeAnimators(double duration, uint32_t samplingRate) {
+    _animatorCurveCache = AnimatorCurveCache::bake(_animatorEvaluator, duration, samplingRate);
+}
 
-    auto sourcePlainColorRenderableMaterial = scene.registry.view<PlainColorRenderableMaterial>();
-    if(!sourcePlainColorRenderableMaterial.empty()) {
-        registry.insert<PlainColorRenderableMaterial>(sourcePlainColorRenderableMaterial.data(), sourcePlainColorRenderableMaterial.data() + sourcePlainColorRenderableMaterial.size(), *sourcePlainColorRenderableMaterial.raw());
+bool PlayableScene::loadAnimatorCurveCache(const char* path) {
+    auto cache = AnimatorCurveCache::load(path);
+    // Cache must be baked for the same animators
+    if(!cache || cache->fingerprint() != _animatorEvaluator.fingerprint() ||
+       cache->valueCount() != _animatorEvaluator.valueCount() - _animatorEvaluator.timeValueBegin()) {
+        return false;
     }
-    
-    // Clone camera
-    registry.emplace<SPTPerspectiveCamera>(descriptor.viewCameraEntity, scene.registry.get<SPTPerspectiveCamera>(descriptor.viewCameraEntity));
-    registry.emplace<spt::ProjectionMatrix>(descriptor.viewCameraEntity, scene.registry.get<spt::ProjectionMatrix>(descriptor.viewCameraEntity));
-    params.viewCameraEntity = descriptor.viewCameraEntity;
-    
+    _animatorCurveCache = std::move(cache);
+    return true;
 }
 
-void PlayableScene::prepareTransformationAnimations(const Scene& scene, const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex) {
-    
-    // Prepare transformation animators
-    std::unordered_map<SPTEntity, spt::Transformation::AnimatorRecord> transformAnimatedEntityRecord;
-    
-    // Position
-    
-    // Cartesian
-    auto cartesianXView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyCartesianPositionX>>();
-    cartesianXView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.cartesian.x = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto cartesianYView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyCartesianPositionY>>();
-    cartesianYView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.cartesian.y = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto cartesianZView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyCartesianPositionZ>>();
-    cartesianZView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.cartesian.z = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    // Linear
-    auto linearOffsetView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyLinearPositionOffset>>();
-    linearOffsetView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.linear.offset = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    // Spherical
-    auto sphericalRadiusView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertySphericalPositionRadius>>();
-    sphericalRadiusView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.spherical.radius = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto sphericalLongitudeView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertySphericalPositionLongitude>>();
-    sphericalLongitudeView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.spherical.longitude = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto sphericalLatitudeView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertySphericalPositionLatitude>>();
-    sphericalLatitudeView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.spherical.latitude = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    // Cylindrical
-    auto cylindricalRadiusView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyCylindricalPositionRadius>>();
-    cylindricalRadiusView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.cylindrical.radius = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto cylindricalLongitudeView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyCylindricalPositionLongitude>>();
-    cylindricalLongitudeView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.cylindrical.longitude = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto sphericalHeightView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyCylindricalPositionHeight>>();
-    sphericalHeightView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].positionRecord.cylindrical.height = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    // Orientation
-    
-    // Euler
-    
-    auto eulerOrientationXView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyEulerOrientationX>>();
-    eulerOrientationXView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].orientationRecord.euler.x = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-    
-    auto eulerOrientationYView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyEulerOrientationY>>();
-    eulerOrientationYView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].orientationRecord.euler.y = AnimatorBindingItemBase{ comp.base, it->second };
+bool PlayableScene::saveAnimatorCurveCache(const char* path) const {
+    return _animatorCurveCache && _animatorCurveCache->save(path);
+}
+
+std::vector<SPTEntity> PlayableScene::collectAnimatedEntities(const Scene& scene, const std::vector<uint32_t>& animatorValueIndices) const {
+    std::vector<SPTEntity> entities;
+    scene.registry.view<ObjectAnimatorBindings>().each([&entities, &animatorValueIndices] (auto entity, const auto& objectBindings) {
+        if(std::any_of(objectBindings.bindings.begin(), objectBindings.bindings.end(), [&animatorValueIndices] (const auto& binding) {
+            return getAnimatorValueIndex(animatorValueIndices, binding.animatorId) != 0;
+        })) {
+            entities.push_back(entity);
         }
     });
+    return entities;
+}
+
+void PlayableScene::cloneAnimatedEntities(const Scene& scene, const SPTPlayableSceneDescriptor& descriptor, const std::vector<SPTEntity>& animatedEntities) {
+    
+    // The camera is included as its view matrix is resolved in 'registry'
+    auto entities = animatedEntities;
+    entities.push_back(descriptor.viewCameraEntity);
+    std::sort(entities.begin(), entities.end());
+    entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+    
+    // Descendants move along with animated entities
+    const auto boundEntityCount = entities.size();
+    for(std::size_t i = 0; i < entities.size(); ++i) {
+        Transformation::forEachChild(scene.registry, entities[i], [&entities] (auto childEntity, const auto&) {
+            entities.push_back(childEntity);
+        });
+    }
+    if(entities.size() > boundEntityCount) {
+        std::sort(entities.begin(), entities.end());
+        entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+    }
     
-    auto eulerOrientationZView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyEulerOrientationZ>>();
-    eulerOrientationZView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].orientationRecord.euler.z = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
+    // Clone entities keeping their identifiers
+    for(const auto entity: entities) {
+        registry.create(entity);
+    }
     
-    // Scale
+    // Clone components
+    for(const auto entity: entities) {
+        cloneComponents<spt::Transformation, SPTPosition, SPTOrientation, SPTScale, SPTMeshLook, PhongRenderableMaterial, PlainColorRenderableMaterial>(scene.registry, registry, entity);
+    }
     
-    // XYZ
-    auto xyzScaleXView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyXYZScaleX>>();
-    xyzScaleXView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].scaleRecord.xyz.x = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
+    // Clone camera
+    cloneComponents<SPTPerspectiveCamera, spt::ProjectionMatrix>(scene.registry, registry, descriptor.viewCameraEntity);
+    params.viewCameraEntity = descriptor.viewCameraEntity;
     
-    auto xyzScaleYView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyXYZScaleY>>();
-    xyzScaleYView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].scaleRecord.xyz.y = AnimatorBindingItemBase{ comp.base, it->second };
+    // Nodes under shared parents are laid out as roots with the parent global matrix folded into the local one
+    for(const auto entity: entities) {
+        auto& tran = registry.get<spt::Transformation>(entity);
+        if(tran.node.parent != kSPTNullEntity && !registry.valid(tran.node.parent)) {
+            tran.node.parent = kSPTNullEntity;
+            _sharedParentChildren.emplace_back(entity, tran.local);
         }
-    });
+    }
     
-    auto xyzScaleZView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyXYZScaleZ>>();
-    xyzScaleZView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].scaleRecord.xyz.z = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
-   
-    auto uniformScaleXView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyUniformScale>>();
-    uniformScaleXView.each([&animatorIdToValueIndex, &transformAnimatedEntityRecord] (auto entity, const auto& comp) {
-        if(auto it = animatorIdToValueIndex.find(comp.base.animatorId); it != animatorIdToValueIndex.end()) {
-            transformAnimatedEntityRecord[entity].scaleRecord.uniform = AnimatorBindingItemBase{ comp.base, it->second };
-        }
-    });
+    _transformationHierarchy.rebuild(registry);
     
-    for(auto& item: transformAnimatedEntityRecord) {
-        item.second.basePosition = registry.get<SPTPosition>(item.first);
-        item.second.baseScale = registry.get<SPTScale>(item.first);
-        item.second.baseOrientation = registry.get<SPTOrientation>(item.first);
-        registry.emplace<spt::Transformation::AnimatorRecord>(item.first, item.second);
+    for(const auto& [entity, local]: _sharedParentChildren) {
+        _transformationHierarchy.setLocal(registry.get<spt::Transformation>(entity), multiply(getSharedParentGlobal(scene, entity), local));
     }
     
-    // Sort once because parent child relationships are not going to change
-    _transformationGroup.sort<Transformation>([] (const auto& lhs, const auto& rhs) {
-        return lhs.node.level < rhs.node.level;
+    // Objects made in the scene later are not rendered
+    scene.registry.view<SPTMeshLook>().each([this] (auto entity, const auto&) {
+        if(!registry.valid(entity)) {
+            _sharedEntities.emplace(entity);
+        }
     });
     
 }
 
-void PlayableScene::prepareMeshLookAnimations(const Scene& scene, const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex) {
-    
-    // HSB
-    std::unordered_map<SPTEntity, HSBColorAnimatorAnimatorRecord> hsbAnimatedEntityRecord;
-    
-    forEachHSBChannelBinding<SPTAnimatableObjectPropertyHue>(scene, animatorIdToValueIndex, [&hsbAnimatedEntityRecord] (auto entity, const auto& item) {
-        hsbAnimatedEntityRecord[entity].hueItem = item;
-    });
-    
-    forEachHSBChannelBinding<SPTAnimatableObjectPropertySaturation>(scene, animatorIdToValueIndex, [&hsbAnimatedEntityRecord] (auto entity, const auto& item) {
-        hsbAnimatedEntityRecord[entity].saturationItem = item;
-    });
-    
-    forEachHSBChannelBinding<SPTAnimatableObjectPropertyBrightness>(scene, animatorIdToValueIndex, [&hsbAnimatedEntityRecord] (auto entity, const auto& item) {
-        hsbAnimatedEntityRecord[entity].brightnessItem = item;
-    });
-    
-    for(auto& item: hsbAnimatedEntityRecord) {
-        registry.emplace<HSBColorAnimatorAnimatorRecord>(item.first, item.second);
+AffineMatrix PlayableScene::getSharedParentGlobal(const Scene& scene, SPTEntity entity) const {
+    const auto parent = scene.registry.get<spt::Transformation>(entity).node.parent;
+    if(parent == kSPTNullEntity || registry.valid(parent)) {
+        return AffineMatrix {};
     }
-    
-    // RGB
-    prepareRGBChannelAnimation<SPTAnimatableObjectPropertyRed>(scene, animatorIdToValueIndex);
-    prepareRGBChannelAnimation<SPTAnimatableObjectPropertyGreen>(scene, animatorIdToValueIndex);
-    prepareRGBChannelAnimation<SPTAnimatableObjectPropertyBlue>(scene, animatorIdToValueIndex);
-    
-    // Shininess
-    auto shininessView = scene.registry.view<spt::AnimatorBinding<SPTAnimatableObjectPropertyShininess>, SPTMeshLook>();
-    shininessView.each([this, &animatorIdToValueIndex] (auto entity, const auto& binding, const auto& look) {
-        if(look.shading.type == SPTMeshShadingTypeBlinnPhong) {
-            if(auto it = animatorIdToValueIndex.find(binding.base.animatorId); it != animatorIdToValueIndex.end()) {
-                registry.emplace<spt::AnimatorBindingItem<SPTAnimatableObjectPropertyShininess>>(entity, AnimatorBindingItemBase {binding.base, it->second});
-            }
-        }
-    });
-    
+    return scene.registry.get<spt::Transformation>(parent).global;
 }
 
-template <SPTAnimatableObjectProperty P>
-void PlayableScene::prepareRGBChannelAnimation(const Scene& scene,  const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex) {
+void PlayableScene::prepareAnimations(const Scene& scene, const std::vector<SPTEntity>& animatedEntities, const std::vector<uint32_t>& animatorValueIndices) {
     
-    auto view = scene.registry.view<spt::AnimatorBinding<P>, SPTMeshLook>();
-    view.each([this, &animatorIdToValueIndex] (auto entity, const auto& binding, const auto& look) {
-        switch(look.shading.type) {
-            case SPTMeshShadingTypeBlinnPhong: {
-                if(look.shading.blinnPhong.color.model != SPTColorModelRGB) {
-                    return;
-                }
-                break;
+    for(const auto entity: animatedEntities) {
+        
+        Transformation::AnimatorRecord transformationRecord {};
+        auto isTransformationAnimated = false;
+        
+        HSBColorAnimatorAnimatorRecord hsbRecord {};
+        auto isHSBColorAnimated = false;
+        
+        const auto meshLook = registry.try_get<SPTMeshLook>(entity);
+        
+        scene.registry.get<ObjectAnimatorBindings>(entity).forEach([this, entity, &animatorValueIndices, &transformationRecord, &isTransformationAnimated, &hsbRecord, &isHSBColorAnimated, meshLook] (auto property, const auto& binding) {
+            
+            const auto valueIndex = getAnimatorValueIndex(animatorValueIndices, binding.animatorId);
+            if(valueIndex == 0) {
+                return;
             }
-            case SPTMeshShadingTypePlainColor: {
-                if(look.shading.plainColor.color.model != SPTColorModelRGB) {
-                    return;
-                }
-                break;
+            
+            if(const auto item = getTransformationBindingItem(transformationRecord, property)) {
+                *item = AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)};
+                isTransformationAnimated = true;
+                return;
             }
-        }
-        
-        if(auto it = animatorIdToValueIndex.find(binding.base.animatorId); it != animatorIdToValueIndex.end()) {
-            registry.emplace<spt::AnimatorBindingItem<P>>(entity, AnimatorBindingItemBase {binding.base, it->second});
-        }
-    });
-    
-}
-
-template <SPTAnimatableObjectProperty P>
-void PlayableScene::forEachHSBChannelBinding(const Scene& scene,  const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex, const std::function<void (SPTEntity, const AnimatorBindingItemBase&)>& action) {
-    
-    auto view = scene.registry.view<spt::AnimatorBinding<P>, SPTMeshLook>();
-    view.each([this, &animatorIdToValueIndex, &action] (auto entity, const auto& binding, const auto& look) {
-        switch(look.shading.type) {
-            case SPTMeshShadingTypeBlinnPhong: {
-                if(look.shading.blinnPhong.color.model != SPTColorModelHSB) {
-                    return;
-                }
-                break;
+            
+            if(!meshLook) {
+                return;
             }
-            case SPTMeshShadingTypePlainColor: {
-                if(look.shading.plainColor.color.model != SPTColorModelHSB) {
-                    return;
+            
+            switch (property) {
+                case SPTAnimatableObjectPropertyHue: {
+                    if(getColorModel(*meshLook) == SPTColorModelHSB) {
+                        hsbRecord.hueItem = AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)};
+                        isHSBColorAnimated = true;
+                    }
+                    break;
+                }
+                case SPTAnimatableObjectPropertySaturation: {
+                    if(getColorModel(*meshLook) == SPTColorModelHSB) {
+                        hsbRecord.saturationItem = AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)};
+                        isHSBColorAnimated = true;
+                    }
+                    break;
+                }
+                case SPTAnimatableObjectPropertyBrightness: {
+                    if(getColorModel(*meshLook) == SPTColorModelHSB) {
+                        hsbRecord.brightnessItem = AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)};
+                        isHSBColorAnimated = true;
+                    }
+                    break;
+                }
+                case SPTAnimatableObjectPropertyRed: {
+                    if(getColorModel(*meshLook) == SPTColorModelRGB) {
+                        registry.emplace<spt::AnimatorBindingItem<SPTAnimatableObjectPropertyRed>>(entity, AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)});
+                    }
+                    break;
+                }
+                case SPTAnimatableObjectPropertyGreen: {
+                    if(getColorModel(*meshLook) == SPTColorModelRGB) {
+                        registry.emplace<spt::AnimatorBindingItem<SPTAnimatableObjectPropertyGreen>>(entity, AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)});
+                    }
+                    break;
                 }
-                break;
+                case SPTAnimatableObjectPropertyBlue: {
+                    if(getColorModel(*meshLook) == SPTColorModelRGB) {
+                        registry.emplace<spt::AnimatorBindingItem<SPTAnimatableObjectPropertyBlue>>(entity, AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)});
+                    }
+                    break;
+                }
+                case SPTAnimatableObjectPropertyShininess: {
+                    if(meshLook->shading.type == SPTMeshShadingTypeBlinnPhong) {
+                        registry.emplace<spt::AnimatorBindingItem<SPTAnimatableObjectPropertyShininess>>(entity, AnimatorBindingItemBase {_animatorBindingEvaluator.addBinding(binding, valueIndex)});
+                    }
+                    break;
+                }
+                default:
+                    break;
             }
+        });
+        
+        if(isTransformationAnimated) {
+            transformationRecord.basePosition = registry.get<SPTPosition>(entity);
+            transformationRecord.baseScale = registry.get<SPTScale>(entity);
+            transformationRecord.baseOrientation = registry.get<SPTOrientation>(entity);
+            transformationRecord.sharedParentGlobal = getSharedParentGlobal(scene, entity);
+            registry.emplace<spt::Transformation::AnimatorRecord>(entity, transformationRecord);
         }
         
-        if(auto it = animatorIdToValueIndex.find(binding.base.animatorId); it != animatorIdToValueIndex.end()) {
-            action(entity, AnimatorBindingItemBase{ binding.base, it->second });
+        if(isHSBColorAnimated) {
+            registry.emplace<HSBColorAnimatorAnimatorRecord>(entity, hsbRecord);
         }
-    });
+    }
+    
 }
 
 }
 
 SPTHandle SPTPlayableSceneMake(SPTHandle sceneHandle, SPTPlayableSceneDescriptor descriptor) {
     
-    auto scene = static_cast<spt::Scene*>(sceneHandle);
-    scene->updateTransformations();
-    scene->updateLooks();
-    
-    return new spt::PlayableScene(*scene, descriptor);
+    return new spt::PlayableScene(*static_cast<spt::Scene*>(sceneHandle), descriptor);
 }
 
 void SPTPlayableSceneDestroy(SPTHandle sceneHandle) {
@@ -375,3 +408,15 @@ void SPTPlayableSceneDestroy(SPTHandle sceneHandle) {
 SPTPlayableSceneParams SPTPlayableSceneGetParams(SPTHandle sceneHandle) {
     return static_cast<spt::PlayableScene*>(sceneHandle)->params;
 }
+
+void SPTPlayableSceneBakeAnimators(SPTHandle sceneHandle, double duration, uint32_t samplingRate) {
+    static_cast<spt::PlayableScene*>(sceneHandle)->bakeAnimators(duration, samplingRate);
+}
+
+bool SPTPlayableSceneLoadAnimatorCurveCache(SPTHandle sceneHandle, const char* _Nonnull path) {
+    return static_cast<spt::PlayableScene*>(sceneHandle)->loadAnimatorCurveCache(path);
+}
+
+bool SPTPlayableSceneSaveAnimatorCurveCache(SPTHandle sceneHandle, const char* _Nonnull path) {
+    return static_cast<spt::PlayableScene*>(sceneHandle)->saveAnimatorCurveCache(path);
+}
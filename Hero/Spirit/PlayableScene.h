@@ -22,10 +22,21 @@ typedef struct {
     uint32_t animatorsSize;
 } SPTPlayableSceneDescriptor;
 
+// Objects that are not animated are shared with the scene, which is frozen until the playable scene
+// is destroyed, see 'SPTSceneIsFrozen'. Destroying the scene meanwhile is postponed until then
 SPTHandle SPTPlayableSceneMake(SPTHandle sceneHandle, SPTPlayableSceneDescriptor descriptor);
 
 void SPTPlayableSceneDestroy(SPTHandle sceneHandle);
 
 SPTPlayableSceneParams SPTPlayableSceneGetParams(SPTHandle sceneHandle);
 
+// Bakes time dependent animators over [0, duration) into a quantized table which is read
+// during playback instead of evaluating them, playback loops over the baked range
+void SPTPlayableSceneBakeAnimators(SPTHandle sceneHandle, double duration, uint32_t samplingRate);
+
+// Loaded cache is memory mapped, fails if it is baked for a different set of animators
+bool SPTPlayableSceneLoadAnimatorCurveCache(SPTHandle sceneHandle, const char* _Nonnull path);
+
+bool SPTPlayableSceneSaveAnimatorCurveCache(SPTHandle sceneHandle, const char* _Nonnull path);
+
 SPT_EXTERN_C_END
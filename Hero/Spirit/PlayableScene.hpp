@@ -11,9 +11,14 @@
 #include "PlayableScene.h"
 #include "Renderer.hpp"
 #include "Animator.h"
+#include "AnimatorEvaluator.hpp"
+#include "AnimatorBindingEvaluator.hpp"
+#include "AnimatorCurveCache.hpp"
 #include "Transformation.hpp"
+#include "TransformationHierarchy.hpp"
 
 #include <entt/entt.hpp>
+#include <optional>
 
 namespace spt {
 
@@ -21,29 +26,59 @@ class Scene;
 
 class PlayableScene {
 public:
-    PlayableScene(const Scene& scene, const SPTPlayableSceneDescriptor& descriptor);
+    // Only animated objects, their descendants and the view camera are copied, the rest
+    // is read from the scene registry, hence 'scene' is frozen while it is played and
+    // its destruction is postponed until then. Changes of shared objects are picked up by 'update'
+    PlayableScene(Scene& scene, const SPTPlayableSceneDescriptor& descriptor);
+    ~PlayableScene();
+    
+    PlayableScene(const PlayableScene&) = delete;
+    PlayableScene& operator=(const PlayableScene&) = delete;
     
     void evaluateAnimators(const SPTAnimatorEvaluationContext& context);
     void update();
     
+    // Time dependent animator values are read from the cache afterwards
+    void bakeAnimators(double duration, uint32_t samplingRate);
+    bool loadAnimatorCurveCache(const char* path);
+    bool saveAnimatorCurveCache(const char* path) const;
+    
+    // Objects recorded in 'sharedEntities' are rendered from here
+    const Registry& sharedRegistry() const;
+    
+    // Renderable scene objects that are not copied, recorded when the playable scene is made
+    const EntitySet& sharedEntities() const { return _sharedEntities; }
+    
     SPTPlayableSceneParams params;
     Registry registry;
     
 private:
     
-    void cloneEntities(const Scene& scene, const SPTPlayableSceneDescriptor& descriptor);
-    void prepareTransformationAnimations(const Scene& scene, const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex);
-    void prepareMeshLookAnimations(const Scene& scene, const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex);
-    
-    template <SPTAnimatableObjectProperty P>
-    void prepareRGBChannelAnimation(const Scene& scene,  const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex);
-    
-    template <SPTAnimatableObjectProperty P>
-    void forEachHSBChannelBinding(const Scene& scene,  const std::unordered_map<SPTAnimatorId, size_t>& animatorIdToValueIndex, const std::function<void (SPTEntity, const AnimatorBindingItemBase&)>& action);
+    // Entities with bindings to played animators, 'animatorValueIndices' are indexed by animator entity index
+    std::vector<SPTEntity> collectAnimatedEntities(const Scene& scene, const std::vector<uint32_t>& animatorValueIndices) const;
+    void cloneAnimatedEntities(const Scene& scene, const SPTPlayableSceneDescriptor& descriptor, const std::vector<SPTEntity>& animatedEntities);
+    AffineMatrix getSharedParentGlobal(const Scene& scene, SPTEntity entity) const;
+    // Brings changed shared objects up to date along with copies laid out under them
+    void updateSharedObjects();
+    void prepareAnimations(const Scene& scene, const std::vector<SPTEntity>& animatedEntities, const std::vector<uint32_t>& animatorValueIndices);
     
-    std::vector<SPTAnimatorId> _animatorIds;
+    Scene& _sharedScene;
+    EntitySet _sharedEntities;
+    // Copies whose parent is shared, with their own local matrix
+    std::vector<std::pair<SPTEntity, AffineMatrix>> _sharedParentChildren;
+    AnimatorEvaluator _animatorEvaluator;
+    std::optional<AnimatorCurveCache> _animatorCurveCache;
     std::vector<float> _animatorValues;
+    std::vector<float> _previousAnimatorValues;
+    // Set for values that differ from the previous evaluation
+    std::vector<uint8_t> _animatorValueChangeFlags;
+    AnimatorBindingEvaluator _animatorBindingEvaluator;
+    // Values of all bindings, indexed by binding slots of animator records
+    std::vector<float> _boundValues;
+    std::vector<uint8_t> _boundValueChangeFlags;
     Transformation::AnimatorsGroupType _transformationGroup;
+    std::vector<Transformation::AnimatorsPartition> _transformationAnimatorsPartitions;
+    TransformationHierarchy _transformationHierarchy;
     
 };
 
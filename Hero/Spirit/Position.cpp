@@ -72,7 +72,7 @@ SPTPosition SPTPositionMultiplyScalar(SPTPosition position, float scalar) {
 
 void SPTPositionMake(SPTObject object, SPTPosition position) {
     auto& registry = spt::Scene::getRegistry(object);
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    spt::Transformation::markDirty(registry, object.entity);
     registry.emplace<SPTPosition>(object.entity, position);
     spt::notifyComponentDidEmergeObservers(registry, object.entity, position);
 }
@@ -80,7 +80,7 @@ void SPTPositionMake(SPTObject object, SPTPosition position) {
 void SPTPositionUpdate(SPTObject object, SPTPosition newPosition) {
     auto& registry = spt::Scene::getRegistry(object);
     spt::notifyComponentWillChangeObservers(registry, object.entity, newPosition);
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    spt::Transformation::markDirty(registry, object.entity);
     spt::notifyComponentDidChangeObservers(registry, object.entity, spt::update(registry, object.entity, newPosition));
 }
 
@@ -227,22 +227,26 @@ namespace spt {
 
 namespace Position {
 
+simd_float3 getCartesianCoordinates(const SPTPosition& position) {
+    switch (position.coordinateSystem) {
+        case SPTCoordinateSystemCartesian: {
+            return position.cartesian;
+        }
+        case SPTCoordinateSystemLinear: {
+            return SPTLinearCoordinatesToCartesian(position.linear);
+        }
+        case SPTCoordinateSystemSpherical: {
+            return SPTSphericalCoordinatesToCartesian(position.spherical);
+        }
+        case SPTCoordinateSystemCylindrical: {
+            return SPTCylindricalCoordinatesToCartesian(position.cylindrical);
+        }
+    }
+}
+
 simd_float3 getCartesianCoordinates(const spt::Registry& registry, SPTEntity entity) {
     if(const auto position = registry.try_get<SPTPosition>(entity)) {
-        switch (position->coordinateSystem) {
-            case SPTCoordinateSystemCartesian: {
-                return position->cartesian;
-            }
-            case SPTCoordinateSystemLinear: {
-                return SPTLinearCoordinatesToCartesian(position->linear);
-            }
-            case SPTCoordinateSystemSpherical: {
-                return SPTSphericalCoordinatesToCartesian(position->spherical);
-            }
-            case SPTCoordinateSystemCylindrical: {
-                return SPTCylindricalCoordinatesToCartesian(position->cylindrical);
-            }
-        }
+        return getCartesianCoordinates(*position);
     }
     return {0.f, 0.f, 0.f};
 }
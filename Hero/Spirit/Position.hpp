@@ -21,7 +21,7 @@ void make(spt::Registry& registry, It beginEntity, It endEntity, std::size_t sta
     auto index = startIndex;
     for(auto it = beginEntity; it != endEntity; ++it, ++index) {
         const auto entity = *it;
-        spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, entity);
+        spt::Transformation::markDirty(registry, entity);
         registry.emplace<SPTPosition>(entity, positionGenerator(index));
     }
 }
@@ -30,11 +30,13 @@ template <typename It, typename PG>
 void update(spt::Registry& registry, It beginEntity, It endEntity, PG positionUpdater) {
     for(auto it = beginEntity; it != endEntity; ++it) {
         const auto entity = *it;
-        spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, entity);
+        spt::Transformation::markDirty(registry, entity);
         registry.patch<SPTPosition>(entity, positionUpdater);
     }
 }
 
+simd_float3 getCartesianCoordinates(const SPTPosition& position);
+
 simd_float3 getCartesianCoordinates(const spt::Registry& registry, SPTEntity entity);
 
 }
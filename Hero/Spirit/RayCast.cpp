@@ -49,7 +49,7 @@ RayCastResult tryRayCastMeshLook(Registry& registry, SPTEntity entity, const SPT
     }
     
     const auto& globalMat = registry.get<spt::Transformation>(entity).global;
-    SPTRay localRay = SPTRayTransform(ray, simd_inverse(globalMat));
+    SPTRay localRay = SPTRayTransform(ray, simd_inverse(spt::toMatrix4x4(globalMat)));
     
     const auto& mesh = spt::ResourceManager::active().getMesh(meshLook->meshId);
     
@@ -58,7 +58,7 @@ RayCastResult tryRayCastMeshLook(Registry& registry, SPTEntity entity, const SPT
     if(meshRayCastResult.intersected) {
         
         const auto& point = SPTRayGetPoint(localRay, meshRayCastResult.rayDirectionFactor);
-        auto globalPoint = simd_mul(globalMat, simd_make_float4(point, 1.f)).xyz;
+        auto globalPoint = spt::transformPoint(globalMat, point);
         
         const auto rayFactor = (globalPoint[rayDirectionMaxComponentIndex] - ray.origin[rayDirectionMaxComponentIndex]) / ray.direction[rayDirectionMaxComponentIndex];
         
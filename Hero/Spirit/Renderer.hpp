@@ -16,10 +16,16 @@ class Renderer {
 public:
     
     void render(const Registry& registry, void* renderingContext);
+    
+    // Meshes of 'sharedEntities' are rendered from 'sharedRegistry' along with 'registry'
+    void render(const Registry& registry, const Registry& sharedRegistry, const EntitySet& sharedEntities, void* renderingContext);
 
     static void init();
     
 private:
+    
+    void render(const Registry& registry, const Registry* sharedRegistry, const EntitySet* sharedEntities, void* renderingContext);
+    
     Uniforms _uniforms;
 };
 
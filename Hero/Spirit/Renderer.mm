@@ -88,7 +88,8 @@ void renderPlainColorMesh(id<MTLRenderCommandEncoder> renderEncoder, const Regis
     
     [renderEncoder setFragmentBytes: &material.color length: sizeof(simd_float4) atIndex: kFragmentInputIndexColor];
     
-    [renderEncoder setVertexBytes: &tran.global
+    const auto worldMatrix = toMatrix4x4(tran.global);
+    [renderEncoder setVertexBytes: &worldMatrix
                            length: sizeof(simd_float4x4)
                           atIndex: kVertexInputIndexWorldMatrix];
     
@@ -109,14 +110,14 @@ void renderPhongMesh(id<MTLRenderCommandEncoder> renderEncoder, const Registry&
     
     [renderEncoder setCullMode: tran.isGlobalMirroring ? MTLCullModeFront : MTLCullModeBack];
     
-    // TODO: Optimize this computation to not happen each frame (perhaps as part of instancing optimization)
-    const auto& transposedInverseWorldMatrix = (simd_transpose(simd_inverse(tran.global)));
-    [renderEncoder setVertexBytes: &transposedInverseWorldMatrix
+    const auto normalMatrix = toMatrix4x4(tran.normal);
+    [renderEncoder setVertexBytes: &normalMatrix
                            length: sizeof(simd_float4x4)
                           atIndex: kVertexInputIndexTransposedInverseWorldMatrix];
     [renderEncoder setFragmentBytes: &material length: sizeof(spt::PhongRenderableMaterial) atIndex: kFragmentInputIndexMaterial];
     
-    [renderEncoder setVertexBytes: &tran.global
+    const auto worldMatrix = toMatrix4x4(tran.global);
+    [renderEncoder setVertexBytes: &worldMatrix
                            length: sizeof(simd_float4x4)
                           atIndex: kVertexInputIndexWorldMatrix];
     
@@ -133,7 +134,7 @@ void renderPhongMesh(id<MTLRenderCommandEncoder> renderEncoder, const Registry&
 
 void renderMeshDepthOnly(id<MTLRenderCommandEncoder> renderEncoder, const Registry& registry, SPTEntity entity, SPTMeshId meshId) {
     
-    const auto& worldMatrix = registry.get<Transformation>(entity).global;
+    const auto worldMatrix = toMatrix4x4(registry.get<Transformation>(entity).global);
     
     [renderEncoder setVertexBytes: &worldMatrix
                            length: sizeof(simd_float4x4)
@@ -152,7 +153,7 @@ void renderMeshDepthOnly(id<MTLRenderCommandEncoder> renderEncoder, const Regist
 
 void renderPolyline(id<MTLRenderCommandEncoder> renderEncoder, const Registry& registry, SPTEntity entity, const SPTPolylineLook& polylineLook) {
     
-    const auto& worldMatrix = registry.get<Transformation>(entity).global;
+    const auto worldMatrix = toMatrix4x4(registry.get<Transformation>(entity).global);
     [renderEncoder setVertexBytes: &worldMatrix
                            length: sizeof(simd_float4x4)
                           atIndex: kVertexInputIndexWorldMatrix];
@@ -174,7 +175,7 @@ void renderPolyline(id<MTLRenderCommandEncoder> renderEncoder, const Registry& r
 
 void renderArc(id<MTLRenderCommandEncoder> renderEncoder, const Registry& registry, SPTEntity entity, const SPTArcLook& arcLook) {
     
-    const auto& worldMatrix = registry.get<Transformation>(entity).global;
+    const auto worldMatrix = toMatrix4x4(registry.get<Transformation>(entity).global);
     [renderEncoder setVertexBytes: &worldMatrix
                            length: sizeof(simd_float4x4)
                           atIndex: kVertexInputIndexWorldMatrix];
@@ -194,9 +195,7 @@ void renderArc(id<MTLRenderCommandEncoder> renderEncoder, const Registry& regist
 
 void renderPoint(id<MTLRenderCommandEncoder> renderEncoder, const Registry& registry, SPTEntity entity, const SPTPointLook& pointLook) {
     
-    const auto& worldMatrix = registry.get<Transformation>(entity).global;
-    
-    const auto& worldPos = worldMatrix.columns[3].xyz;
+    const auto worldPos = getTranslation(registry.get<Transformation>(entity).global);
     std::array<PointVertex, 4> vertices {
         PointVertex {worldPos, simd_float2 {-1.f, -1.f}},
         PointVertex {worldPos, simd_float2 {1.f, -1.f}},
@@ -213,7 +212,7 @@ void renderPoint(id<MTLRenderCommandEncoder> renderEncoder, const Registry& regi
     
 }
 
-void renderMeshOutline(id<MTLRenderCommandEncoder> renderEncoder, const Mesh& mesh, const SPTOutlineLook& outlineLook, const simd_float4x4& globalMatrix) {
+void renderMeshOutline(id<MTLRenderCommandEncoder> renderEncoder, const Mesh& mesh, const SPTOutlineLook& outlineLook, const simd_float4x4& globalMatrix, const simd_float4x4& normalMatrix) {
     
     [renderEncoder setVertexBytes: &globalMatrix
                            length: sizeof(simd_float4x4)
@@ -221,9 +220,7 @@ void renderMeshOutline(id<MTLRenderCommandEncoder> renderEncoder, const Mesh& me
     
     [renderEncoder setVertexBytes: &outlineLook.thickness length: sizeof(float) atIndex: kVertexInputIndexThickness];
     
-    // TODO: Optimize this computation to not happen each frame (perhaps as part of instancing optimization)
-    const auto& transposedInverseWorldMatrix = (simd_transpose(simd_inverse(globalMatrix)));
-    [renderEncoder setVertexBytes: &transposedInverseWorldMatrix
+    [renderEncoder setVertexBytes: &normalMatrix
                            length: sizeof(simd_float4x4)
                           atIndex: kVertexInputIndexTransposedInverseWorldMatrix];
     
@@ -244,12 +241,41 @@ void renderOutline(id<MTLRenderCommandEncoder> renderEncoder, const Registry& re
         const auto& mesh = ResourceManager::active().getMesh(meshLook->meshId);
         const auto& tran = registry.get<Transformation>(entity);
         [renderEncoder setCullMode: tran.isGlobalMirroring ? MTLCullModeBack : MTLCullModeFront];
-        renderMeshOutline(renderEncoder, mesh, outlineLook, tran.global);
+        renderMeshOutline(renderEncoder, mesh, outlineLook, toMatrix4x4(tran.global), toMatrix4x4(tran.normal));
     }
     
 }
 
+template <typename P>
+void renderMeshes(id<MTLRenderCommandEncoder> renderEncoder, const Registry& registry, SPTRenderingContext* rc, P predicate) {
+    
+    [renderEncoder setRenderPipelineState: __plainColorMeshPipelineState];
+    const auto plainColorMeshLookView = registry.view<spt::PlainColorRenderableMaterial, SPTMeshLook>();
+    plainColorMeshLookView.each([&registry, renderEncoder, rc, &predicate] (auto entity, const auto& material, const auto& meshLook) {
+        if((rc.lookCategories & meshLook.categories) && predicate(entity)) {
+            renderPlainColorMesh(renderEncoder, registry, entity, meshLook.meshId, material);
+        }
+    });
+    
+    [renderEncoder setRenderPipelineState: __blinnPhongMeshPipelineState];
+    const auto phongMeshLookView = registry.view<spt::PhongRenderableMaterial, SPTMeshLook>();
+    phongMeshLookView.each([&registry, renderEncoder, rc, &predicate] (auto entity, const auto& material, const auto& meshLook) {
+        if((rc.lookCategories & meshLook.categories) && predicate(entity)) {
+            renderPhongMesh(renderEncoder, registry, entity, meshLook.meshId, material);
+        }
+    });
+    
+}
+
 void Renderer::render(const Registry& registry, void* renderingContext) {
+    render(registry, nullptr, nullptr, renderingContext);
+}
+
+void Renderer::render(const Registry& registry, const Registry& sharedRegistry, const EntitySet& sharedEntities, void* renderingContext) {
+    render(registry, &sharedRegistry, &sharedEntities, renderingContext);
+}
+
+void Renderer::render(const Registry& registry, const Registry* sharedRegistry, const EntitySet* sharedEntities, void* renderingContext) {
     
     SPTRenderingContext* rc = (__bridge SPTRenderingContext*) renderingContext;
 
@@ -268,20 +294,14 @@ void Renderer::render(const Registry& registry, void* renderingContext) {
     [renderEncoder setFragmentBytes: &_uniforms length: sizeof(_uniforms) atIndex: kFragmentInputIndexUniforms];
     
     // Render meshes
-    [renderEncoder setRenderPipelineState: __plainColorMeshPipelineState];
-    const auto plainColorMeshLookView = registry.view<spt::PlainColorRenderableMaterial, SPTMeshLook>();
-    plainColorMeshLookView.each([&registry, renderEncoder, rc] (auto entity, const auto& material, const auto& meshLook) {
-        if(rc.lookCategories & meshLook.categories) {
-            renderPlainColorMesh(renderEncoder, registry, entity, meshLook.meshId, material);
-        }
-    });
-    
-    [renderEncoder setRenderPipelineState: __blinnPhongMeshPipelineState];
-    const auto phongMeshLookView = registry.view<spt::PhongRenderableMaterial, SPTMeshLook>();
-    phongMeshLookView.each([&registry, renderEncoder, rc] (auto entity, const auto& material, const auto& meshLook) {
-        if(rc.lookCategories & meshLook.categories) {
-            renderPhongMesh(renderEncoder, registry, entity, meshLook.meshId, material);
-        }
+    if(sharedRegistry) {
+        // Entities present in 'registry' have their own up to date copies
+        renderMeshes(renderEncoder, *sharedRegistry, rc, [sharedEntities] (auto entity) {
+            return sharedEntities->contains(entity);
+        });
+    }
+    renderMeshes(renderEncoder, registry, rc, [] (auto) {
+        return true;
     });
     
     
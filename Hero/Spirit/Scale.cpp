@@ -12,14 +12,18 @@
 
 namespace spt::Scale {
 
+simd_float3 getXYZ(const SPTScale& scale) {
+    switch (scale.model) {
+        case SPTScaleModelXYZ:
+            return scale.xyz;
+        case SPTScaleModelUniform:
+            return {scale.uniform, scale.uniform, scale.uniform};
+    }
+}
+
 simd_float3 getXYZ(const spt::Registry& registry, SPTEntity entity) {
     if(const auto scale = registry.try_get<SPTScale>(entity); scale) {
-        switch (scale->model) {
-            case SPTScaleModelXYZ:
-                return scale->xyz;
-            case SPTScaleModelUniform:
-                return {scale->uniform, scale->uniform, scale->uniform};
-        }
+        return getXYZ(*scale);
     }
     return {1.f, 1.f, 1.f};
 }
@@ -43,7 +47,7 @@ bool SPTScaleEqual(SPTScale lhs, SPTScale rhs) {
 
 void SPTScaleMake(SPTObject object, SPTScale scale) {
     auto& registry = spt::Scene::getRegistry(object);
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    spt::Transformation::markDirty(registry, object.entity);
     registry.emplace<SPTScale>(object.entity, scale);
     spt::notifyComponentDidEmergeObservers(registry, object.entity, scale);
 }
@@ -51,7 +55,7 @@ void SPTScaleMake(SPTObject object, SPTScale scale) {
 void SPTScaleUpdate(SPTObject object, SPTScale newScale) {
     auto& registry = spt::Scene::getRegistry(object);
     spt::notifyComponentWillChangeObservers(registry, object.entity, newScale);
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    spt::Transformation::markDirty(registry, object.entity);
     spt::notifyComponentDidChangeObservers(registry, object.entity, spt::update(registry, object.entity, newScale));
 }
 
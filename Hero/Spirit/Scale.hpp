@@ -18,6 +18,8 @@ namespace Scale {
     template <typename It>
     static void make(spt::Registry& registry, It beginEntity, It endEntity, simd_float3 scale);
         
+    simd_float3 getXYZ(const SPTScale& scale);
+    
     simd_float3 getXYZ(const spt::Registry& registry, SPTEntity entity);
 
 }
@@ -26,7 +28,7 @@ template <typename It>
 void Scale::make(spt::Registry& registry, It beginEntity, It endEntity, simd_float3 scale) {
     registry.insert(beginEntity, endEntity, SPTScale{SPTScaleModelXYZ, .xyz = scale});
     for(auto it = beginEntity; it != endEntity; ++it) {
-        spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, *it);
+        spt::Transformation::markDirty(registry, *it);
     }
 }
 
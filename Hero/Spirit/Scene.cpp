@@ -11,64 +11,187 @@
 #include "Action.hpp"
 
 #include <vector>
+#include <algorithm>
+#include <iterator>
 
 
 namespace spt {
 
 namespace {
 
-void destroyEntity(Registry& registry, SPTEntity entity) {
-    
-    // Removing all 'Transformation' component children as well.
-    // Prefering iterative over recursive algorithm to avoid stack overflow.
-    // Possibly this can be optimized by vector reserve
-    std::vector<SPTEntity> entities {1, entity};
-    for (std::size_t i = 0; i < entities.size(); ++i) {
-        const auto entity = entities[i];
-        spt::Transformation::forEachChild(registry, entity, [&entities] (auto childEntity, const auto&) {
-            entities.push_back(childEntity);
-        });
-    }
-    
-    // Destroy children first then parents since children need to remove themselves from their parents
-    for(auto it = entities.crbegin(); it != entities.crend(); ++it) {
-        registry.destroy(*it);
-    }
-    
+template <typename... Cs>
+void reserveStorages(Registry& registry, std::size_t count) {
+    (registry.storage<Cs>().reserve(registry.storage<Cs>().size() + count), ...);
 }
 
 }
 
 Scene::Scene()
-: _transformationGroup {registry.group<DirtyTransformationFlag, Transformation>()}
+: _transformationInputsGroup {registry.group<Transformation, SPTPosition, SPTOrientation, SPTScale>()}
 , _time{0.0} {
+    registry.on_construct<Transformation>().connect<&TransformationHierarchy::onTransformationConstruct>(_transformationHierarchy);
     registry.on_destroy<Transformation>().connect<&Transformation::onDestroy>();
+    registry.on_destroy<Transformation>().connect<&TransformationHierarchy::onTransformationDestroy>(_transformationHierarchy);
     registry.on_destroy<SPTMeshLook>().connect<&MeshLook::onDestroy>();
 }
 
 Scene::~Scene() {
+    // Playable scenes would keep reading the destroyed registry
+    assert(!isFrozen());
+    registry.on_construct<Transformation>().disconnect<&TransformationHierarchy::onTransformationConstruct>(_transformationHierarchy);
     registry.on_destroy<Transformation>().disconnect<&Transformation::onDestroy>();
+    registry.on_destroy<Transformation>().disconnect<&TransformationHierarchy::onTransformationDestroy>(_transformationHierarchy);
     registry.on_destroy<SPTMeshLook>().disconnect<&MeshLook::onDestroy>();
 }
 
 void Scene::update(double time) {
     _time = time;
+    
+    // Actions are time based and catch up on the first update after unfreezing
+    if(isFrozen()) {
+        return;
+    }
+    
     updateActions(registry, time);
     updateTransformations();
     updateLooks();
+    destroyDeferredObjects();
+}
+
+void Scene::freeze() {
+    // Shared transformations and looks are brought up to date once and stay unchanged afterwards
+    if(_freezeCount++ == 0) {
+        updateTransformations();
+        updateLooks();
+    }
+}
+
+void Scene::unfreeze() {
+    assert(isFrozen());
+    if(--_freezeCount == 0 && _isDestroyRequested) {
+        delete this;
+    }
+}
+
+void Scene::destroy(Scene* scene) {
+    if(scene->isFrozen()) {
+        scene->_isDestroyRequested = true;
+    } else {
+        delete scene;
+    }
 }
 
 void Scene::updateTransformations() {
-    Transformation::updateWithoutAnimators(registry, _transformationGroup);
+    Transformation::updateWithoutAnimators(registry, _transformationInputsGroup, _transformationHierarchy);
 }
 
 void Scene::updateLooks() {
     MeshLook::update(registry);
 }
 
+bool Scene::makeObjects(std::size_t count, const SPTObjectsTemplate& objectsTemplate) {
+    
+    // Playable scenes do not know about new objects
+    if(isFrozen()) {
+        _entityBuffer.clear();
+        return false;
+    }
+    
+    _entityBuffer.resize(count);
+    const auto first = _entityBuffer.begin();
+    const auto last = _entityBuffer.end();
+    
+    registry.reserve(registry.size() + count);
+    reserveStorages<Transformation>(registry, count);
+    registry.create(first, last);
+    
+    // Each new node is appended to the root level of the hierarchy
+    registry.insert<Transformation>(first, last);
+    
+    if(objectsTemplate.positions) {
+        reserveStorages<SPTPosition>(registry, count);
+        registry.insert<SPTPosition>(first, last, objectsTemplate.positions);
+    }
+    
+    if(objectsTemplate.orientations) {
+        reserveStorages<SPTOrientation>(registry, count);
+        registry.insert<SPTOrientation>(first, last, objectsTemplate.orientations);
+    }
+    
+    if(objectsTemplate.scales) {
+        reserveStorages<SPTScale>(registry, count);
+        registry.insert<SPTScale>(first, last, objectsTemplate.scales);
+    }
+    
+    if(objectsTemplate.positions || objectsTemplate.orientations || objectsTemplate.scales) {
+        reserveStorages<DirtyTransformationFlag>(registry, count);
+        registry.insert<DirtyTransformationFlag>(first, last);
+    }
+    
+    if(objectsTemplate.meshLooks) {
+        MeshLook::makeBatch(registry, _entityBuffer.data(), objectsTemplate.meshLooks, count);
+    }
+    
+    return true;
+}
+
 void Scene::destroyObject(SPTObject object) {
-    assert(!SPTIsNull(object));
-    destroyEntity(getRegistry(object), object.entity);
+    static_cast<Scene*>(object.sceneHandle)->destroyObjects(&object, 1);
+}
+
+void Scene::destroyObjects(const SPTObject* objects, std::size_t count) {
+    _entityBuffer.clear();
+    for(std::size_t i = 0; i < count; ++i) {
+        assert(!SPTIsNull(objects[i]));
+        assert(objects[i].sceneHandle == this);
+        _entityBuffer.push_back(objects[i].entity);
+    }
+    
+    // Playable scenes may be rendering the objects
+    if(isFrozen()) {
+        for(const auto entity: _entityBuffer) {
+            destroyObjectDeferred(entity);
+        }
+        _entityBuffer.clear();
+        return;
+    }
+    
+    destroySubtrees();
+}
+
+void Scene::destroyObjectDeferred(SPTEntity entity) {
+    _deferredDestroyQueues[0].push_back(entity);
+}
+
+void Scene::destroySubtrees() {
+    
+    // Iterative traversal to avoid stack overflow
+    Transformation::collectSubtreesForDestroy(registry, _entityBuffer);
+    
+    _transformationHierarchy.onSubtreesDestroy(registry, _entityBuffer.data(), _entityBuffer.size());
+    
+    registry.destroy(_entityBuffer.begin(), _entityBuffer.end());
+    _entityBuffer.clear();
+}
+
+void Scene::destroyDeferredObjects() {
+    
+    auto& dueQueue = _deferredDestroyQueues[1];
+    if(!dueQueue.empty()) {
+        // The same object may be requested more than once or destroyed meanwhile
+        std::sort(dueQueue.begin(), dueQueue.end());
+        const auto end = std::unique(dueQueue.begin(), dueQueue.end());
+        
+        _entityBuffer.clear();
+        std::copy_if(dueQueue.begin(), end, std::back_inserter(_entityBuffer), [this] (auto entity) {
+            return registry.valid(entity);
+        });
+        destroySubtrees();
+        
+        dueQueue.clear();
+    }
+    
+    std::swap(_deferredDestroyQueues[0], _deferredDestroyQueues[1]);
 }
 
 }
@@ -78,16 +201,48 @@ SPTHandle SPTSceneMake() {
 }
 
 void SPTSceneDestroy(SPTHandle handle) {
-    delete static_cast<spt::Scene*>(handle);
+    spt::Scene::destroy(static_cast<spt::Scene*>(handle));
+}
+
+bool SPTSceneIsFrozen(SPTHandle handle) {
+    return static_cast<spt::Scene*>(handle)->isFrozen();
 }
 
 SPTObject SPTSceneMakeObject(SPTHandle sceneHandle) {
+    if(static_cast<spt::Scene*>(sceneHandle)->isFrozen()) {
+        return kSPTNullObject;
+    }
     auto& registry = spt::Scene::getRegistry(sceneHandle);
     const auto entity = registry.create();
     registry.emplace<spt::Transformation>(entity);
     return SPTObject { entity, sceneHandle };
 }
 
+void SPTSceneMakeObjects(SPTHandle sceneHandle, size_t count, SPTObjectsTemplate objectsTemplate, SPTObject* _Nonnull objects) {
+    auto& scene = *static_cast<spt::Scene*>(sceneHandle);
+    if(!scene.makeObjects(count, objectsTemplate)) {
+        std::fill(objects, objects + count, kSPTNullObject);
+        return;
+    }
+    
+    const auto& entities = scene.entityBuffer();
+    for(size_t i = 0; i < count; ++i) {
+        objects[i] = SPTObject { entities[i], sceneHandle };
+    }
+}
+
 void SPTSceneDestroyObject(SPTObject object) {
     spt::Scene::destroyObject(object);
 }
+
+void SPTSceneDestroyObjects(const SPTObject* _Nonnull objects, size_t count) {
+    if(count == 0) {
+        return;
+    }
+    static_cast<spt::Scene*>(objects[0].sceneHandle)->destroyObjects(objects, count);
+}
+
+void SPTSceneDestroyObjectDeferred(SPTObject object) {
+    assert(!SPTIsNull(object));
+    static_cast<spt::Scene*>(object.sceneHandle)->destroyObjectDeferred(object.entity);
+}
@@ -5,19 +5,49 @@
 //  Created by Vanush Grigoryan on 09.09.22.
 //
 
+#pragma once
+
 #include "Base.h"
+#include "Position.h"
+#include "Orientation.h"
+#include "Scale.h"
+#include "MeshLook.h"
 
 
 SPT_EXTERN_C_BEGIN
 
 SPTHandle SPTSceneMake();
 
+// A scene played by playable scenes is destroyed once the last of them is destroyed
 void SPTSceneDestroy(SPTHandle handle);
 
+// A scene is frozen while it is shared with playable scenes, see 'SPTPlayableSceneMake'.
+// Objects of a frozen scene are not made and their destruction is deferred
+bool SPTSceneIsFrozen(SPTHandle handle);
+
+// Null object if the scene is frozen
 SPTObject SPTSceneMakeObject(SPTHandle sceneHandle);
 
+// Component arrays of objects created in bulk, null array leaves the component out
+typedef struct {
+    const SPTPosition* _Nullable positions;
+    const SPTOrientation* _Nullable orientations;
+    const SPTScale* _Nullable scales;
+    const SPTMeshLook* _Nullable meshLooks;
+} SPTObjectsTemplate;
+
+// Creates 'count' root objects writing them to 'objects', null objects if the scene is frozen.
+// Component pools are reserved once and components are inserted from the template arrays
+void SPTSceneMakeObjects(SPTHandle sceneHandle, size_t count, SPTObjectsTemplate objectsTemplate, SPTObject* _Nonnull objects);
+
+// While the scene is frozen the destruction is deferred as with 'SPTSceneDestroyObjectDeferred'
+// and happens after it is unfrozen, the object stays valid until then
 void SPTSceneDestroyObject(SPTObject object);
 
+// Objects must be distinct and belong to the same scene, subtrees are destroyed as well.
+// Deferred like 'SPTSceneDestroyObject' while the scene is frozen
+void SPTSceneDestroyObjects(const SPTObject* _Nonnull objects, size_t count);
+
 // Destroys object 2 frames after the request.
 // These are enough run loop cycles for SwiftUI to process
 // object dependent views lifecycle calls (onChange, onDisappear)
@@ -9,8 +9,10 @@
 
 #include "Base.h"
 #include "Base.hpp"
+#include "Scene.h"
 #include "Renderer.hpp"
 #include "Transformation.hpp"
+#include "TransformationHierarchy.hpp"
 
 #include <entt/entt.hpp>
 #include <tuple>
@@ -31,6 +33,20 @@ public:
     
     double time() const { return _time; }
     
+    // Playable scenes read components of the scene instead of copying them, hence it is frozen
+    // while any of them exists. Updates of a frozen scene are postponed, objects are not made
+    // and destroy requests are deferred until it is unfrozen. Each freeze holds a reference,
+    // the scene is deleted by the last 'unfreeze' if 'destroy' was called meanwhile
+    void freeze();
+    void unfreeze();
+    
+    bool isFrozen() const { return _freezeCount > 0; }
+    
+    static void destroy(Scene* scene);
+    
+    TransformationHierarchy& transformationHierarchy() { return _transformationHierarchy; }
+    const TransformationHierarchy& transformationHierarchy() const { return _transformationHierarchy; }
+    
     static Registry& getRegistry(SPTHandle sceneHandle) {
         return static_cast<spt::Scene*>(sceneHandle)->registry;
     }
@@ -39,13 +55,38 @@ public:
         return getRegistry(object.sceneHandle);
     }
     
+    // Created entities are available in 'entityBuffer' until the next bulk operation,
+    // fails on a frozen scene
+    bool makeObjects(std::size_t count, const SPTObjectsTemplate& objectsTemplate);
+    
+    const std::vector<SPTEntity>& entityBuffer() const { return _entityBuffer; }
+    
     static void destroyObject(SPTObject object);
     
+    // Destroys distinct objects with their subtrees without unlinking each destroyed node
+    void destroyObjects(const SPTObject* objects, std::size_t count);
+    
+    // Destroyed at the end of the second update following the request
+    void destroyObjectDeferred(SPTEntity entity);
+    
     Registry registry;
     
 private:
-    Transformation::GroupType _transformationGroup;
+    
+    // Destroys subtrees rooted at '_entityBuffer' entities
+    void destroySubtrees();
+    
+    void destroyDeferredObjects();
+    
+    Transformation::InputsGroupType _transformationInputsGroup;
+    TransformationHierarchy _transformationHierarchy;
+    // Reused to keep bulk operations allocation free
+    std::vector<SPTEntity> _entityBuffer;
+    // Front queue receives requests, back queue is due at the end of the next update
+    std::vector<SPTEntity> _deferredDestroyQueues[2];
     double _time;
+    std::size_t _freezeCount = 0;
+    bool _isDestroyRequested = false;
 };
 
 }
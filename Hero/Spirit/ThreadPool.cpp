@@ -0,0 +1,136 @@
+//
+//  ThreadPool.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace spt {
+
+ThreadPool::ThreadPool(std::size_t workerCount) {
+    _queues.reserve(workerCount + 1);
+    for(std::size_t i = 0; i <= workerCount; ++i) {
+        _queues.push_back(std::make_unique<Queue>());
+    }
+    _threads.reserve(workerCount);
+    for(std::size_t i = 0; i < workerCount; ++i) {
+        _threads.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock {_mutex};
+        _isStopping = true;
+    }
+    _condition.notify_all();
+    for(auto& thread: _threads) {
+        thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::active() {
+    // Calling thread is also a worker
+    static ThreadPool instance {std::max(std::thread::hardware_concurrency(), 1u) - 1};
+    return instance;
+}
+
+void ThreadPool::run(RangeFunction function, void* context, std::size_t begin, std::size_t end, std::size_t grainSize) {
+    assert(grainSize > 0);
+    
+    const auto chunkCount = (end - begin + grainSize - 1) / grainSize;
+    Job job {function, context, {chunkCount}};
+    
+    // Spread chunks round robin so that workers start with a balanced share
+    for(std::size_t queueIndex = 0; queueIndex < _queues.size(); ++queueIndex) {
+        auto& queue = *_queues[queueIndex];
+        std::lock_guard lock {queue.mutex};
+        for(auto chunkIndex = queueIndex; chunkIndex < chunkCount; chunkIndex += _queues.size()) {
+            const auto chunkBegin = begin + chunkIndex * grainSize;
+            queue.chunks.push_back(Chunk {&job, chunkBegin, std::min(chunkBegin + grainSize, end)});
+        }
+    }
+    
+    {
+        std::lock_guard lock {_mutex};
+        _queuedChunkCount.fetch_add(chunkCount, std::memory_order_release);
+    }
+    _condition.notify_all();
+    
+    const auto callerQueueIndex = _queues.size() - 1;
+    Chunk chunk;
+    while(job.pendingChunkCount.load(std::memory_order_acquire) > 0) {
+        if(tryTake(callerQueueIndex, chunk)) {
+            execute(chunk);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool ThreadPool::tryTake(std::size_t queueIndex, Chunk& chunk) {
+    if(_queuedChunkCount.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    
+    {
+        auto& queue = *_queues[queueIndex];
+        std::lock_guard lock {queue.mutex};
+        if(queue.front < queue.chunks.size()) {
+            chunk = queue.chunks.back();
+            queue.chunks.pop_back();
+            if(queue.front == queue.chunks.size()) {
+                queue.chunks.clear();
+                queue.front = 0;
+            }
+            _queuedChunkCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    
+    for(std::size_t i = 1; i < _queues.size(); ++i) {
+        auto& victim = *_queues[(queueIndex + i) % _queues.size()];
+        std::lock_guard lock {victim.mutex};
+        if(victim.front < victim.chunks.size()) {
+            chunk = victim.chunks[victim.front++];
+            if(victim.front == victim.chunks.size()) {
+                victim.chunks.clear();
+                victim.front = 0;
+            }
+            _queuedChunkCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+void ThreadPool::execute(const Chunk& chunk) {
+    chunk.job->function(chunk.job->context, chunk.begin, chunk.end);
+    chunk.job->pendingChunkCount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::workerLoop(std::size_t queueIndex) {
+    Chunk chunk;
+    while(true) {
+        if(tryTake(queueIndex, chunk)) {
+            execute(chunk);
+            continue;
+        }
+        
+        std::unique_lock lock {_mutex};
+        _condition.wait(lock, [this] {
+            return _isStopping || _queuedChunkCount.load(std::memory_order_acquire) > 0;
+        });
+        if(_isStopping) {
+            return;
+        }
+    }
+}
+
+}
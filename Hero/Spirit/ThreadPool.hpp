@@ -0,0 +1,94 @@
+//
+//  ThreadPool.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+namespace spt {
+
+// Work stealing pool for data parallel loops. Ranges are split into chunks
+// which are spread over per worker queues, idle workers steal from the others.
+// The calling thread takes part in the work and returns when all chunks are done
+class ThreadPool {
+public:
+    
+    explicit ThreadPool(std::size_t workerCount);
+    ~ThreadPool();
+    
+    static ThreadPool& active();
+    
+    // Calls 'function(begin, end)' for consecutive subranges of [begin, end) with at most 'grainSize' elements
+    template <typename F>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, F&& function);
+    
+    std::size_t workerCount() const { return _threads.size(); }
+
+private:
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+    
+    using RangeFunction = void (*)(void* context, std::size_t begin, std::size_t end);
+    
+    struct Job {
+        RangeFunction function;
+        void* context;
+        std::atomic<std::size_t> pendingChunkCount;
+    };
+    
+    struct Chunk {
+        Job* job;
+        std::size_t begin;
+        std::size_t end;
+    };
+    
+    // Owner pushes and pops at the back, thieves take from the front
+    struct Queue {
+        std::mutex mutex;
+        std::vector<Chunk> chunks;
+        std::size_t front = 0;
+    };
+    
+    void run(RangeFunction function, void* context, std::size_t begin, std::size_t end, std::size_t grainSize);
+    bool tryTake(std::size_t queueIndex, Chunk& chunk);
+    void execute(const Chunk& chunk);
+    void workerLoop(std::size_t queueIndex);
+    
+    std::vector<std::thread> _threads;
+    // One queue per worker and the last one for the calling thread
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::atomic<std::size_t> _queuedChunkCount {0};
+    bool _isStopping = false;
+};
+
+template <typename F>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grainSize, F&& function) {
+    if(begin >= end) {
+        return;
+    }
+    if(_threads.empty() || end - begin <= grainSize) {
+        function(begin, end);
+        return;
+    }
+    run([] (void* context, std::size_t begin, std::size_t end) {
+        (*static_cast<std::remove_reference_t<F>*>(context))(begin, end);
+    }, &function, begin, end, grainSize);
+}
+
+}
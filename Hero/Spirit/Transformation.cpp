@@ -11,142 +11,261 @@
 #include "Orientation.hpp"
 #include "Scale.hpp"
 #include "Scene.hpp"
+#include "TransformationHierarchy.hpp"
 #include "ComponentObserverUtil.hpp"
 #include "Base.hpp"
-#include "Matrix.h"
 #include "Matrix+Orientation.h"
 
-#include <queue>
+#include <algorithm>
+#include <tuple>
 
 namespace spt {
 
 namespace {
 
-simd_float4x4 computeTransformationMatrix(const spt::Registry& registry, SPTEntity entity) {
-    auto matrix = matrix_identity_float4x4;
-    
-    const auto& scale = spt::Scale::getXYZ(registry, entity);
-    matrix.columns[0][0] = scale.x;
-    matrix.columns[1][1] = scale.y;
-    matrix.columns[2][2] = scale.z;
-    
-    const auto& pos = Position::getCartesianCoordinates(registry, entity);
+// Share of dirty objects within the inputs group, as a divisor, starting from which it is walked
+// densely instead of looking up each dirty object
+constexpr std::size_t kDenseInputsUpdateDivisor = 4;
+
+AffineMatrix computeTransformationMatrix(const SPTPosition& position, const SPTOrientation& orientation, const SPTScale& scale) {
     
-    matrix = simd_mul(SPTMatrix4x4CreateUpperLeft(Orientation::getMatrix(registry, entity, pos)), matrix);
+    const auto pos = Position::getCartesianCoordinates(position);
     
-    matrix.columns[3].xyz = pos;
+    auto upperLeft = Orientation::getMatrix(orientation, pos);
+    const auto xyz = spt::Scale::getXYZ(scale);
+    upperLeft.columns[0] *= xyz.x;
+    upperLeft.columns[1] *= xyz.y;
+    upperLeft.columns[2] *= xyz.z;
     
-    return matrix;
+    return makeAffineMatrix(upperLeft, pos);
 }
 
-simd_float4x4 computeTransformationMatrix(const spt::Registry& registry, SPTEntity entity, const Transformation::AnimatorRecord& animRecord, const std::vector<float> animatorValues) {
+AffineMatrix computeTransformationMatrix(const spt::Registry& registry, SPTEntity entity) {
     
-    auto matrix = matrix_identity_float4x4;
+    const auto& pos = Position::getCartesianCoordinates(registry, entity);
     
-    auto scale = animRecord.baseScale;
-    switch (scale.model) {
-        case SPTScaleModelXYZ:
-            if(animRecord.scaleRecord.xyz.x.index != 0) {
-                scale.xyz.x = evaluateAnimatorBinding(animRecord.scaleRecord.xyz.x.binding, animatorValues[animRecord.scaleRecord.xyz.x.index]);
-            }
-            
-            if(animRecord.scaleRecord.xyz.y.index != 0) {
-                scale.xyz.y = evaluateAnimatorBinding(animRecord.scaleRecord.xyz.y.binding, animatorValues[animRecord.scaleRecord.xyz.y.index]);
-            }
-            
-            if(animRecord.scaleRecord.xyz.z.index != 0) {
-                scale.xyz.z = evaluateAnimatorBinding(animRecord.scaleRecord.xyz.z.binding, animatorValues[animRecord.scaleRecord.xyz.z.index]);
-            }
-            
-            matrix.columns[0][0] = scale.xyz.x;
-            matrix.columns[1][1] = scale.xyz.y;
-            matrix.columns[2][2] = scale.xyz.z;
-            
-            break;
-        case SPTScaleModelUniform:
-            
-            if(animRecord.scaleRecord.uniform.index != 0) {
-                scale.uniform = evaluateAnimatorBinding(animRecord.scaleRecord.uniform.binding, animatorValues[animRecord.scaleRecord.uniform.index]);
-            }
-            
-            matrix.columns[0][0] = scale.uniform;
-            matrix.columns[1][1] = scale.uniform;
-            matrix.columns[2][2] = scale.uniform;
-            
-            break;
-    }
+    // Scaling columns of the rotation matrix is equivalent to multiplying by the scale matrix
+    auto upperLeft = Orientation::getMatrix(registry, entity, pos);
+    const auto& scale = spt::Scale::getXYZ(registry, entity);
+    upperLeft.columns[0] *= scale.x;
+    upperLeft.columns[1] *= scale.y;
+    upperLeft.columns[2] *= scale.z;
     
-    auto orientation = animRecord.baseOrientation;
-    switch (orientation.model) {
+    return makeAffineMatrix(upperLeft, pos);
+}
+
+// Values are returned rather than written through a reference as vector components can not be bound to one
+inline float addBoundChannel(const AnimatorBindingItemBase& item, const std::vector<float>& boundValues, float value) {
+    return (item.slot != 0 ? value + boundValues[item.slot] : value);
+}
+
+inline float setBoundChannel(const AnimatorBindingItemBase& item, const std::vector<float>& boundValues, float value) {
+    return (item.slot != 0 ? boundValues[item.slot] : value);
+}
+
+constexpr bool isEulerOrientationModel(SPTOrientationModel model) {
+    switch (model) {
         case SPTOrientationModelEulerXYZ:
         case SPTOrientationModelEulerXZY:
         case SPTOrientationModelEulerYXZ:
         case SPTOrientationModelEulerYZX:
         case SPTOrientationModelEulerZXY:
         case SPTOrientationModelEulerZYX:
-            orientation.euler.x += evaluateAnimatorBinding(animRecord.orientationRecord.euler.x.binding, animatorValues[animRecord.orientationRecord.euler.x.index]);
-            orientation.euler.y += evaluateAnimatorBinding(animRecord.orientationRecord.euler.y.binding, animatorValues[animRecord.orientationRecord.euler.y.index]);
-            orientation.euler.z += evaluateAnimatorBinding(animRecord.orientationRecord.euler.z.binding, animatorValues[animRecord.orientationRecord.euler.z.index]);
-            break;
+            return true;
         default:
-            assert(false);
-            break;
+            return false;
     }
+}
+
+constexpr bool isAnimatableOrientationModel(SPTOrientationModel model) {
+    return isEulerOrientationModel(model) || model == SPTOrientationModelQuaternion;
+}
+
+template <SPTOrientationModel OM>
+simd_float3x3 computeEulerOrientationMatrix(simd_float3 angles) {
+    if constexpr (OM == SPTOrientationModelEulerXYZ) {
+        return SPTMatrix3x3CreateEulerXYZOrientation(angles);
+    } else if constexpr (OM == SPTOrientationModelEulerXZY) {
+        return SPTMatrix3x3CreateEulerXZYOrientation(angles);
+    } else if constexpr (OM == SPTOrientationModelEulerYXZ) {
+        return SPTMatrix3x3CreateEulerYXZOrientation(angles);
+    } else if constexpr (OM == SPTOrientationModelEulerYZX) {
+        return SPTMatrix3x3CreateEulerYZXOrientation(angles);
+    } else if constexpr (OM == SPTOrientationModelEulerZXY) {
+        return SPTMatrix3x3CreateEulerZXYOrientation(angles);
+    } else {
+        static_assert(OM == SPTOrientationModelEulerZYX);
+        return SPTMatrix3x3CreateEulerZYXOrientation(angles);
+    }
+}
+
+// Specialized for the model combination, evaluates only bound channels
+template <SPTCoordinateSystem CS, SPTOrientationModel OM, SPTScaleModel SM>
+AffineMatrix computeTransformationMatrix(const spt::Registry& registry, SPTEntity entity, const Transformation::AnimatorRecord& animRecord, const std::vector<float>& boundValues) {
     
-    matrix = simd_mul(SPTMatrix4x4CreateUpperLeft(SPTOrientationGetMatrix(orientation)), matrix);
-    
+    simd_float3 translation;
     auto position = animRecord.basePosition;
+    if constexpr (CS == SPTCoordinateSystemCartesian) {
+        position.cartesian.x = addBoundChannel(animRecord.positionRecord.cartesian.x, boundValues, position.cartesian.x);
+        position.cartesian.y = addBoundChannel(animRecord.positionRecord.cartesian.y, boundValues, position.cartesian.y);
+        position.cartesian.z = addBoundChannel(animRecord.positionRecord.cartesian.z, boundValues, position.cartesian.z);
+        translation = position.cartesian;
+    } else if constexpr (CS == SPTCoordinateSystemLinear) {
+        position.linear.offset = addBoundChannel(animRecord.positionRecord.linear.offset, boundValues, position.linear.offset);
+        translation = SPTLinearCoordinatesToCartesian(position.linear);
+    } else if constexpr (CS == SPTCoordinateSystemSpherical) {
+        position.spherical.radius = addBoundChannel(animRecord.positionRecord.spherical.radius, boundValues, position.spherical.radius);
+        position.spherical.longitude = addBoundChannel(animRecord.positionRecord.spherical.longitude, boundValues, position.spherical.longitude);
+        position.spherical.latitude = addBoundChannel(animRecord.positionRecord.spherical.latitude, boundValues, position.spherical.latitude);
+        translation = SPTSphericalCoordinatesToCartesian(position.spherical);
+    } else {
+        static_assert(CS == SPTCoordinateSystemCylindrical);
+        position.cylindrical.radius = addBoundChannel(animRecord.positionRecord.cylindrical.radius, boundValues, position.cylindrical.radius);
+        position.cylindrical.longitude = addBoundChannel(animRecord.positionRecord.cylindrical.longitude, boundValues, position.cylindrical.longitude);
+        position.cylindrical.height = addBoundChannel(animRecord.positionRecord.cylindrical.height, boundValues, position.cylindrical.height);
+        translation = SPTCylindricalCoordinatesToCartesian(position.cylindrical);
+    }
     
-    switch (position.coordinateSystem) {
-        case SPTCoordinateSystemCartesian:
-            
-            position.cartesian.x += evaluateAnimatorBinding(animRecord.positionRecord.cartesian.x.binding, animatorValues[animRecord.positionRecord.cartesian.x.index]);
-            position.cartesian.y += evaluateAnimatorBinding(animRecord.positionRecord.cartesian.y.binding, animatorValues[animRecord.positionRecord.cartesian.y.index]);
-            position.cartesian.z += evaluateAnimatorBinding(animRecord.positionRecord.cartesian.z.binding, animatorValues[animRecord.positionRecord.cartesian.z.index]);
-            matrix.columns[3].xyz = position.cartesian;
-            
-            break;
-        case SPTCoordinateSystemLinear:
-            
-            position.linear.offset += evaluateAnimatorBinding(animRecord.positionRecord.linear.offset.binding, animatorValues[animRecord.positionRecord.linear.offset.index]);
-            matrix.columns[3].xyz = SPTLinearCoordinatesToCartesian(position.linear);
-            
-            break;
-        case SPTCoordinateSystemSpherical:
-            
-            position.spherical.radius += evaluateAnimatorBinding(animRecord.positionRecord.spherical.radius.binding, animatorValues[animRecord.positionRecord.spherical.radius.index]);
-            position.spherical.longitude += evaluateAnimatorBinding(animRecord.positionRecord.spherical.longitude.binding, animatorValues[animRecord.positionRecord.spherical.longitude.index]);
-            position.spherical.latitude += evaluateAnimatorBinding(animRecord.positionRecord.spherical.latitude.binding, animatorValues[animRecord.positionRecord.spherical.latitude.index]);
-            matrix.columns[3].xyz = SPTSphericalCoordinatesToCartesian(position.spherical);
-            
-            break;
-        case SPTCoordinateSystemCylindrical:
-            
-            position.cylindrical.radius += evaluateAnimatorBinding(animRecord.positionRecord.cylindrical.radius.binding, animatorValues[animRecord.positionRecord.cylindrical.radius.index]);
-            position.cylindrical.longitude += evaluateAnimatorBinding(animRecord.positionRecord.cylindrical.longitude.binding, animatorValues[animRecord.positionRecord.cylindrical.longitude.index]);
-            position.cylindrical.height += evaluateAnimatorBinding(animRecord.positionRecord.cylindrical.height.binding, animatorValues[animRecord.positionRecord.cylindrical.height.index]);
-            matrix.columns[3].xyz = SPTCylindricalCoordinatesToCartesian(position.cylindrical);
-            
-            break;
+    simd_float3x3 upperLeft;
+    if constexpr (isEulerOrientationModel(OM)) {
+        auto angles = animRecord.baseOrientation.euler;
+        angles.x = addBoundChannel(animRecord.orientationRecord.euler.x, boundValues, angles.x);
+        angles.y = addBoundChannel(animRecord.orientationRecord.euler.y, boundValues, angles.y);
+        angles.z = addBoundChannel(animRecord.orientationRecord.euler.z, boundValues, angles.z);
+        upperLeft = computeEulerOrientationMatrix<OM>(angles);
+    } else if constexpr (OM == SPTOrientationModelQuaternion) {
+        // Rotating around the base rotation axis is a single 'sincos' and the matrix needs no trigonometry
+        auto quaternion = animRecord.baseOrientation.quaternion;
+        if(const auto& item = animRecord.orientationRecord.quaternion.angle; item.slot != 0) {
+            const auto angle = boundValues[item.slot];
+            quaternion = simd_mul(quaternion, simd_quaternion(angle, Orientation::getQuaternionAnimationAxis(quaternion)));
+        }
+        upperLeft = simd_matrix3x3(quaternion);
+    } else {
+        // Not animatable, however may depend on the animated position
+        upperLeft = Orientation::getMatrix(registry, entity, translation);
+    }
+    
+    if constexpr (SM == SPTScaleModelXYZ) {
+        auto scale = animRecord.baseScale.xyz;
+        scale.x = setBoundChannel(animRecord.scaleRecord.xyz.x, boundValues, scale.x);
+        scale.y = setBoundChannel(animRecord.scaleRecord.xyz.y, boundValues, scale.y);
+        scale.z = setBoundChannel(animRecord.scaleRecord.xyz.z, boundValues, scale.z);
+        upperLeft.columns[0] *= scale.x;
+        upperLeft.columns[1] *= scale.y;
+        upperLeft.columns[2] *= scale.z;
+    } else {
+        static_assert(SM == SPTScaleModelUniform);
+        auto scale = animRecord.baseScale.uniform;
+        scale = setBoundChannel(animRecord.scaleRecord.uniform, boundValues, scale);
+        upperLeft.columns[0] *= scale;
+        upperLeft.columns[1] *= scale;
+        upperLeft.columns[2] *= scale;
     }
     
-    return matrix;
+    return makeAffineMatrix(upperLeft, translation);
 }
 
-void updateGlobalMatrix(Registry& registry, Transformation& tran) {
+// Unbound channels refer to the reserved slot which is never flagged
+template <SPTCoordinateSystem CS, SPTOrientationModel OM, SPTScaleModel SM>
+bool hasChangedBoundChannel(const Transformation::AnimatorRecord& animRecord, const std::vector<uint8_t>& boundValueChangeFlags) {
     
-    if(tran.node.parent == kSPTNullEntity) {
-        tran.global = tran.local;
+    const auto isChanged = [&boundValueChangeFlags] (const AnimatorBindingItemBase& item) {
+        return boundValueChangeFlags[item.slot] != 0;
+    };
+    
+    bool isPositionChanged;
+    if constexpr (CS == SPTCoordinateSystemCartesian) {
+        isPositionChanged = isChanged(animRecord.positionRecord.cartesian.x) || isChanged(animRecord.positionRecord.cartesian.y) || isChanged(animRecord.positionRecord.cartesian.z);
+    } else if constexpr (CS == SPTCoordinateSystemLinear) {
+        isPositionChanged = isChanged(animRecord.positionRecord.linear.offset);
+    } else if constexpr (CS == SPTCoordinateSystemSpherical) {
+        isPositionChanged = isChanged(animRecord.positionRecord.spherical.radius) || isChanged(animRecord.positionRecord.spherical.longitude) || isChanged(animRecord.positionRecord.spherical.latitude);
+    } else {
+        static_assert(CS == SPTCoordinateSystemCylindrical);
+        isPositionChanged = isChanged(animRecord.positionRecord.cylindrical.radius) || isChanged(animRecord.positionRecord.cylindrical.longitude) || isChanged(animRecord.positionRecord.cylindrical.height);
+    }
+    
+    bool isOrientationChanged = false;
+    if constexpr (isEulerOrientationModel(OM)) {
+        isOrientationChanged = isChanged(animRecord.orientationRecord.euler.x) || isChanged(animRecord.orientationRecord.euler.y) || isChanged(animRecord.orientationRecord.euler.z);
+    } else if constexpr (OM == SPTOrientationModelQuaternion) {
+        isOrientationChanged = isChanged(animRecord.orientationRecord.quaternion.angle);
+    }
+    
+    bool isScaleChanged;
+    if constexpr (SM == SPTScaleModelXYZ) {
+        isScaleChanged = isChanged(animRecord.scaleRecord.xyz.x) || isChanged(animRecord.scaleRecord.xyz.y) || isChanged(animRecord.scaleRecord.xyz.z);
     } else {
-        tran.global = simd_mul(registry.get<Transformation>(tran.node.parent).global, tran.local);
+        static_assert(SM == SPTScaleModelUniform);
+        isScaleChanged = isChanged(animRecord.scaleRecord.uniform);
     }
     
-    tran.isGlobalMirroring = (simd_determinant(SPTMatrix4x4GetUpperLeft(tran.global)) < 0.f);
+    return isPositionChanged || isOrientationChanged || isScaleChanged;
+}
+
+template <SPTCoordinateSystem CS, SPTOrientationModel OM, SPTScaleModel SM>
+void updatePartition(Registry& registry, Transformation::AnimatorsGroupType& group, const Transformation::AnimatorsPartition& partition, TransformationHierarchy& hierarchy, const std::vector<float>& boundValues, const std::vector<uint8_t>& boundValueChangeFlags, uint64_t version) {
+    const auto entities = group.data();
+    for(auto i = partition.begin; i < partition.end; ++i) {
+        const auto entity = entities[i];
+        const auto& animRecord = group.get<Transformation::AnimatorRecord>(entity);
+        // Descendants of recomputed nodes are updated during propagation
+        if(!hasChangedBoundChannel<CS, OM, SM>(animRecord, boundValueChangeFlags)) {
+            continue;
+        }
+        auto& tran = group.get<Transformation>(entity);
+        tran.local = computeTransformationMatrix<CS, OM, SM>(registry, entity, animRecord, boundValues);
+        tran.version = version;
+        hierarchy.setLocal(tran, multiply(animRecord.sharedParentGlobal, tran.local));
+    }
+}
+
+template <SPTCoordinateSystem CS, SPTOrientationModel OM, typename... Args>
+void dispatchScaleModel(SPTScaleModel scaleModel, Args&&... args) {
+    switch (scaleModel) {
+        case SPTScaleModelXYZ:
+            return updatePartition<CS, OM, SPTScaleModelXYZ>(std::forward<Args>(args)...);
+        case SPTScaleModelUniform:
+            return updatePartition<CS, OM, SPTScaleModelUniform>(std::forward<Args>(args)...);
+    }
+}
+
+template <SPTCoordinateSystem CS, typename... Args>
+void dispatchOrientationModel(SPTOrientationModel orientationModel, SPTScaleModel scaleModel, Args&&... args) {
+    switch (orientationModel) {
+        case SPTOrientationModelEulerXYZ:
+            return dispatchScaleModel<CS, SPTOrientationModelEulerXYZ>(scaleModel, std::forward<Args>(args)...);
+        case SPTOrientationModelEulerXZY:
+            return dispatchScaleModel<CS, SPTOrientationModelEulerXZY>(scaleModel, std::forward<Args>(args)...);
+        case SPTOrientationModelEulerYXZ:
+            return dispatchScaleModel<CS, SPTOrientationModelEulerYXZ>(scaleModel, std::forward<Args>(args)...);
+        case SPTOrientationModelEulerYZX:
+            return dispatchScaleModel<CS, SPTOrientationModelEulerYZX>(scaleModel, std::forward<Args>(args)...);
+        case SPTOrientationModelEulerZXY:
+            return dispatchScaleModel<CS, SPTOrientationModelEulerZXY>(scaleModel, std::forward<Args>(args)...);
+        case SPTOrientationModelEulerZYX:
+            return dispatchScaleModel<CS, SPTOrientationModelEulerZYX>(scaleModel, std::forward<Args>(args)...);
+        case SPTOrientationModelQuaternion:
+            return dispatchScaleModel<CS, SPTOrientationModelQuaternion>(scaleModel, std::forward<Args>(args)...);
+        default:
+            // All non animatable models share the generic orientation path
+            return dispatchScaleModel<CS, SPTOrientationModelPointAtDirection>(scaleModel, std::forward<Args>(args)...);
+    }
 }
 
-void updateGlobalMatrix(Transformation& tran, const Transformation& parentTran) {
-    tran.global = simd_mul(parentTran.global, tran.local);
-    tran.isGlobalMirroring = (simd_determinant(SPTMatrix4x4GetUpperLeft(tran.global)) < 0.f);
+template <typename... Args>
+void dispatchPartition(const Transformation::AnimatorsPartition& partition, Args&&... args) {
+    switch (partition.coordinateSystem) {
+        case SPTCoordinateSystemCartesian:
+            return dispatchOrientationModel<SPTCoordinateSystemCartesian>(partition.orientationModel, partition.scaleModel, std::forward<Args>(args)...);
+        case SPTCoordinateSystemLinear:
+            return dispatchOrientationModel<SPTCoordinateSystemLinear>(partition.orientationModel, partition.scaleModel, std::forward<Args>(args)...);
+        case SPTCoordinateSystemSpherical:
+            return dispatchOrientationModel<SPTCoordinateSystemSpherical>(partition.orientationModel, partition.scaleModel, std::forward<Args>(args)...);
+        case SPTCoordinateSystemCylindrical:
+            return dispatchOrientationModel<SPTCoordinateSystemCylindrical>(partition.orientationModel, partition.scaleModel, std::forward<Args>(args)...);
+    }
 }
 
 void removeFromParent(Registry& registry, SPTEntity entity, const Transformation& tran) {
@@ -170,86 +289,187 @@ void removeFromParent(Registry& registry, SPTEntity entity, const Transformation
 
 }
 
+void addToParent(Registry& registry, SPTEntity entity, Transformation& tran, SPTEntity parentEntity) {
+    tran.node.prevSibling = kSPTNullEntity;
+    if(parentEntity == kSPTNullEntity) {
+        tran.node.nextSibling = kSPTNullEntity;
+    } else {
+        auto& parentTran = registry.get<spt::Transformation>(parentEntity);
+        tran.node.nextSibling = parentTran.node.firstChild;
+        
+        if(parentTran.node.firstChild != kSPTNullEntity) {
+            auto& firstChildTran = registry.get<spt::Transformation>(parentTran.node.firstChild);
+            firstChildTran.node.prevSibling = entity;
+        }
+        
+        parentTran.node.firstChild = entity;
+        ++parentTran.node.childrenCount;
+    }
+    
+    tran.node.parent = parentEntity;
+}
+
+}
+
+uint64_t Transformation::makeVersion() {
+    static uint64_t lastVersion = 0;
+    return ++lastVersion;
+}
+
+uint64_t Transformation::getChainVersion(const Registry& registry, SPTEntity entity) {
+    uint64_t chainVersion = 0;
+    auto nextEntity = entity;
+    while (nextEntity != kSPTNullEntity) {
+        const auto& tran = registry.get<spt::Transformation>(nextEntity);
+        chainVersion = std::max(chainVersion, tran.version);
+        nextEntity = tran.node.parent;
+    }
+    return chainVersion;
+}
+
+void Transformation::markDirty(Registry& registry, SPTEntity entity) {
+    spt::emplaceIfMissing<DirtyTransformationFlag>(registry, entity);
+    registry.get<spt::Transformation>(entity).version = makeVersion();
 }
 
 simd_float4x4 Transformation::getGlobal(Registry& registry, SPTEntity entity) {
     
+    // Global matrices above the topmost node with a pending update are up to date
+    uint64_t chainVersion = 0;
+    auto topmostDirtyEntity = kSPTNullEntity;
     auto nextEntity = entity;
-    auto result = matrix_identity_float4x4;
     while (nextEntity != kSPTNullEntity) {
-        const auto& local = (registry.all_of<DirtyTransformationFlag>(nextEntity) ?
-                             computeTransformationMatrix(registry, nextEntity) :
-                             registry.get<spt::Transformation>(nextEntity).local);
-        result = simd_mul(local, result);
-        nextEntity = registry.get<spt::Transformation>(nextEntity).node.parent;
+        const auto& tran = registry.get<spt::Transformation>(nextEntity);
+        chainVersion = std::max(chainVersion, tran.version);
+        if(registry.all_of<DirtyTransformationFlag>(nextEntity)) {
+            topmostDirtyEntity = nextEntity;
+        }
+        nextEntity = tran.node.parent;
+    }
+    
+    if(const auto cache = registry.try_get<GlobalMatrixCache>(entity); cache && cache->chainVersion == chainVersion) {
+        return toMatrix4x4(cache->global);
     }
     
-    return result;
+    AffineMatrix global;
+    if(topmostDirtyEntity == kSPTNullEntity) {
+        global = registry.get<spt::Transformation>(entity).global;
+    } else {
+        // Recompute only the changed suffix of the chain
+        nextEntity = entity;
+        while (true) {
+            const auto& tran = registry.get<spt::Transformation>(nextEntity);
+            const auto& local = (registry.all_of<DirtyTransformationFlag>(nextEntity) ?
+                                 computeTransformationMatrix(registry, nextEntity) :
+                                 tran.local);
+            global = multiply(local, global);
+            if(nextEntity == topmostDirtyEntity) {
+                if(tran.node.parent != kSPTNullEntity) {
+                    global = multiply(registry.get<spt::Transformation>(tran.node.parent).global, global);
+                }
+                break;
+            }
+            nextEntity = tran.node.parent;
+        }
+    }
+    
+    registry.emplace_or_replace<GlobalMatrixCache>(entity, global, chainVersion);
+    
+    return toMatrix4x4(global);
 }
 
-void Transformation::updateWithoutAnimators(Registry& registry, GroupType& group) {
+void Transformation::updateWithoutAnimators(Registry& registry, InputsGroupType& inputsGroup, TransformationHierarchy& hierarchy) {
     
-    // Sort so that parents are updated before their children
-    group.sort<Transformation>([] (const auto& lhs, const auto& rhs) {
-        return lhs.node.level < rhs.node.level;
-    });
+    if(!hierarchy.isValid()) {
+        hierarchy.rebuild(registry);
+    }
     
-    // Recalculate matrices
-    group.each([&registry, &group] (const auto entity, Transformation& tran) {
-        
-        tran.local = computeTransformationMatrix(registry, entity);
-        updateGlobalMatrix(registry, tran);
-        
-        // Update subtree
-        // Prefering iterative over recursive algorithm to avoid stack overflow
-        std::queue<SPTEntity> entityQueue;
-        entityQueue.push(entity);
-        while (!entityQueue.empty()) {
-
-            const auto& parentTran = registry.get<Transformation>(entityQueue.front());
-            forEachChild(registry, entityQueue.front(), [&registry, &entityQueue, &parentTran, &group] (auto childEntity, Transformation& childTran) {
-                // If child is dirty it will be updated as part of outer loop
-                if(!group.contains(childEntity)) {
-                    updateGlobalMatrix(childTran, parentTran);
-                    entityQueue.push(childEntity);
-                }
-            });
-            
-            entityQueue.pop();
-        }
+    // Recalculate local matrices
+    const auto& dirtyFlags = registry.storage<DirtyTransformationFlag>();
+    auto dirtyView = registry.view<DirtyTransformationFlag, Transformation>();
+    if(kDenseInputsUpdateDivisor * dirtyFlags.size() >= inputsGroup.size()) {
+        inputsGroup.each([&dirtyFlags, &hierarchy] (const auto entity, Transformation& tran, const SPTPosition& position, const SPTOrientation& orientation, const SPTScale& scale) {
+            if(dirtyFlags.contains(entity)) {
+                tran.local = computeTransformationMatrix(position, orientation, scale);
+                hierarchy.setLocal(tran, tran.local);
+            }
+        });
         
-    });
+        // Objects missing some of the inputs
+        dirtyView.each([&registry, &inputsGroup, &hierarchy] (const auto entity, Transformation& tran) {
+            if(!inputsGroup.contains(entity)) {
+                tran.local = computeTransformationMatrix(registry, entity);
+                hierarchy.setLocal(tran, tran.local);
+            }
+        });
+    } else {
+        dirtyView.each([&registry, &inputsGroup, &hierarchy] (const auto entity, Transformation& tran) {
+            if(inputsGroup.contains(entity)) {
+                const auto& [position, orientation, scale] = inputsGroup.get<SPTPosition, SPTOrientation, SPTScale>(entity);
+                tran.local = computeTransformationMatrix(position, orientation, scale);
+            } else {
+                tran.local = computeTransformationMatrix(registry, entity);
+            }
+            hierarchy.setLocal(tran, tran.local);
+        });
+    }
+    
+    hierarchy.propagate(registry);
     
     registry.clear<DirtyTransformationFlag>();
 }
 
-void Transformation::updateWithOnlyAnimatorsChanging(Registry& registry, AnimatorsGroupType& group, const std::vector<float> animatorValues) {
+std::vector<Transformation::AnimatorsPartition> Transformation::partitionAnimators(AnimatorsGroupType& group) {
     
-    group.each([&registry, &group, &animatorValues] (const auto entity, AnimatorRecord& animRecord, Transformation& tran) {
-        
-        tran.local = computeTransformationMatrix(registry, entity, animRecord, animatorValues);
-        updateGlobalMatrix(registry, tran);
-        
-        // Update subtree
-        // Prefering iterative over recursive algorithm to avoid stack overflow
-        std::queue<SPTEntity> entityQueue;
-        entityQueue.push(entity);
-        while (!entityQueue.empty()) {
-
-            const auto& parentTran = registry.get<Transformation>(entityQueue.front());
-            forEachChild(registry, entityQueue.front(), [&registry, &entityQueue, &parentTran, &group] (auto childEntity, Transformation& childTran) {
-                // If child has animators bound it will be updated as part of outer loop
-                if(!group.contains(childEntity)) {
-                    updateGlobalMatrix(childTran, parentTran);
-                    entityQueue.push(childEntity);
-                }
-            });
-            
-            entityQueue.pop();
-        }
-        
+    const auto makeKey = [] (const AnimatorRecord& record) {
+        // Non animatable orientation models share the same partition
+        const auto orientationModel = (isAnimatableOrientationModel(record.baseOrientation.model) ? record.baseOrientation.model : SPTOrientationModelPointAtDirection);
+        return std::make_tuple(record.basePosition.coordinateSystem, orientationModel, record.baseScale.model);
+    };
+    
+    group.sort<AnimatorRecord>([&makeKey] (const auto& lhs, const auto& rhs) {
+        return makeKey(lhs) < makeKey(rhs);
     });
     
+    std::vector<AnimatorsPartition> partitions;
+    const auto entities = group.data();
+    for(std::size_t i = 0; i < group.size(); ++i) {
+        const auto [coordinateSystem, orientationModel, scaleModel] = makeKey(group.get<AnimatorRecord>(entities[i]));
+        if(partitions.empty() || partitions.back().coordinateSystem != coordinateSystem || partitions.back().orientationModel != orientationModel || partitions.back().scaleModel != scaleModel) {
+            partitions.push_back(AnimatorsPartition {coordinateSystem, orientationModel, scaleModel, i, i});
+        }
+        partitions.back().end = i + 1;
+    }
+    
+    return partitions;
+}
+
+void Transformation::updateWithOnlyAnimatorsChanging(Registry& registry, AnimatorsGroupType& group, const std::vector<AnimatorsPartition>& partitions, TransformationHierarchy& hierarchy, const std::vector<float>& boundValues, const std::vector<uint8_t>& boundValueChangeFlags) {
+    
+    const auto version = makeVersion();
+    for(const auto& partition: partitions) {
+        dispatchPartition(partition, registry, group, partition, hierarchy, boundValues, boundValueChangeFlags, version);
+    }
+    
+    hierarchy.propagate(registry);
+}
+
+void Transformation::collectSubtreesForDestroy(Registry& registry, std::vector<SPTEntity>& entities) {
+    
+    // Detaching first makes subtrees disjoint even if some roots are nested
+    for(const auto entity: entities) {
+        auto& tran = registry.get<Transformation>(entity);
+        removeFromParent(registry, entity, tran);
+        tran.node.parent = kSPTNullEntity;
+    }
+    
+    for(std::size_t i = 0; i < entities.size(); ++i) {
+        forEachChild(registry, entities[i], [&entities] (auto childEntity, Transformation& childTran) {
+            // Parent is destroyed along with the child, hence there is nothing to unlink from
+            childTran.node.parent = kSPTNullEntity;
+            entities.push_back(childEntity);
+        });
+    }
 }
 
 void Transformation::onDestroy(spt::Registry& registry, SPTEntity entity) {
@@ -283,31 +503,51 @@ void SPTTransformationSetParent(SPTObject object, SPTEntity parentEntity) {
         return;
     }
     
-    // Remove from current parent
     spt::removeFromParent(registry, object.entity, tran);
+    spt::addToParent(registry, object.entity, tran, parentEntity);
     
-    // Add to new parent
-    tran.node.prevSibling = kSPTNullEntity;
-    if(parentEntity == kSPTNullEntity) {
-        tran.node.nextSibling = kSPTNullEntity;
-        tran.node.level = 0;
-    } else {
-        auto& parentTran = registry.get<spt::Transformation>(parentEntity);
-        tran.node.nextSibling = parentTran.node.firstChild;
+    // Updates node levels of the subtree
+    static_cast<spt::Scene*>(object.sceneHandle)->transformationHierarchy().onParentChange(registry, object.entity);
+    
+    spt::Transformation::markDirty(registry, object.entity);
+}
+
+void SPTTransformationSetParentBatch(const SPTObject* _Nonnull objects, size_t count, SPTEntity parentEntity) {
+    if(count == 0) {
+        return;
+    }
+    
+    auto& scene = *static_cast<spt::Scene*>(objects[0].sceneHandle);
+    auto& registry = scene.registry;
+    assert(parentEntity == kSPTNullEntity || registry.valid(parentEntity));
+    
+    std::vector<SPTEntity> movedEntities;
+    movedEntities.reserve(count);
+    
+    for(size_t i = 0; i < count; ++i) {
+        const auto& object = objects[i];
+        assert(object.sceneHandle == objects[0].sceneHandle);
+        assert(object.entity != parentEntity);
+        assert(!SPTIsNull(object));
+        assert(!SPTTransformationIsDescendant(SPTObject {parentEntity, object.sceneHandle}, object));
         
-        if(parentTran.node.firstChild != kSPTNullEntity) {
-            auto& firstChildTran = registry.get<spt::Transformation>(parentTran.node.firstChild);
-            firstChildTran.node.prevSibling = object.entity;
+        auto& tran = registry.get<spt::Transformation>(object.entity);
+        if(tran.node.parent == parentEntity) {
+            continue;
         }
         
-        parentTran.node.firstChild = object.entity;
-        ++parentTran.node.childrenCount;
-        tran.node.level = parentTran.node.level + 1;
+        spt::removeFromParent(registry, object.entity, tran);
+        spt::addToParent(registry, object.entity, tran, parentEntity);
+        movedEntities.push_back(object.entity);
     }
     
-    tran.node.parent = parentEntity;
+    // All moved nodes are siblings now, hence their subtrees are disjoint
+    scene.transformationHierarchy().onParentChange(registry, movedEntities.data(), movedEntities.size());
     
-    spt::emplaceIfMissing<spt::DirtyTransformationFlag>(registry, object.entity);
+    // Globals are recomputed by the next propagation
+    for(const auto entity: movedEntities) {
+        spt::Transformation::markDirty(registry, entity);
+    }
 }
 
 bool SPTTransformationIsDescendant(SPTObject object, SPTObject ancestor) {
@@ -327,5 +567,5 @@ bool SPTTransformationIsDescendant(SPTObject object, SPTObject ancestor) {
 
 simd_float4x4 SPTTransformationGetLocal(SPTObject object) {
     auto& registry = spt::Scene::getRegistry(object);
-    return registry.get<spt::Transformation>(object.entity).local;
+    return spt::toMatrix4x4(registry.get<spt::Transformation>(object.entity).local);
 }
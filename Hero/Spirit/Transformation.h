@@ -28,6 +28,9 @@ SPTTranformationNode SPTTransformationGetNode(SPTObject object);
 
 void SPTTransformationSetParent(SPTObject object, SPTEntity parentEntity);
 
+// Objects must belong to the same scene, hierarchy levels are updated once for all moved subtrees
+void SPTTransformationSetParentBatch(const SPTObject* _Nonnull objects, size_t count, SPTEntity parentEntity);
+
 bool SPTTransformationIsDescendant(SPTObject object, SPTObject ancestor);
 
 simd_float4x4 SPTTransformationGetLocal(SPTObject object);
@@ -14,19 +14,33 @@
 #include "Orientation.h"
 #include "Scale.h"
 #include "AnimatorBinding.hpp"
+#include "AffineMatrix.hpp"
 
 #include <simd/simd.h>
 
 namespace spt {
 
+class TransformationHierarchy;
+
 struct DirtyTransformationFlag {
 };
 
+struct GlobalMatrixCache {
+    AffineMatrix global;
+    uint64_t chainVersion;
+};
+
 struct Transformation {
     
-    simd_float4x4 local { matrix_identity_float4x4 };
-    simd_float4x4 global { matrix_identity_float4x4 };
+    AffineMatrix local;
+    AffineMatrix global;
+    // Transposed inverse of 'global' for transforming normals, updated along with 'global'
+    AffineMatrix normal;
     SPTTranformationNode node { kSPTNullEntity, kSPTNullEntity, kSPTNullEntity, kSPTNullEntity, 0 };
+    // Index in 'TransformationHierarchy' level arrays
+    uint32_t levelIndex { 0 };
+    // Stamp of the last change of the local matrix or parent, see 'makeVersion'
+    uint64_t version { 0 };
     bool isGlobalMirroring { false };
     
     struct AnimatorRecord {
@@ -61,6 +75,9 @@ struct Transformation {
                     AnimatorBindingItemBase y;
                     AnimatorBindingItemBase z;
                 } euler;
+                struct {
+                    AnimatorBindingItemBase angle;
+                } quaternion;
             };
         };
         
@@ -83,8 +100,21 @@ struct Transformation {
         
         ScaleRecord scaleRecord;
         SPTScale baseScale;
+        
+        // Global matrix of a parent that is shared with the scene rather than copied,
+        // in which case the node is laid out as a root. Identity otherwise
+        AffineMatrix sharedParentGlobal;
     };
     
+    // Versions are globally increasing, hence the maximum version along the ancestor chain
+    // changes whenever any of ancestors or the node itself changes
+    static uint64_t makeVersion();
+    static uint64_t getChainVersion(const Registry& registry, SPTEntity entity);
+    
+    // Marks local matrix for recomputation on the next update
+    static void markDirty(Registry& registry, SPTEntity entity);
+    
+    // Up to date global matrix regardless of pending updates, memoized per entity
     static simd_float4x4 getGlobal(Registry& registry, SPTEntity entity);
     
     template <typename It>
@@ -93,11 +123,33 @@ struct Transformation {
     template <typename R, typename UF>
     static void forEachChild(R& registry, SPTEntity entity, UF unaryFunction);
         
-    using GroupType = decltype(Registry().group<DirtyTransformationFlag, Transformation>());
-    static void updateWithoutAnimators(Registry& registry, GroupType& group);
+    // Owns transformation inputs so that local matrices of complete objects are computed
+    // by walking the pools in lockstep
+    using InputsGroupType = decltype(Registry().group<Transformation, SPTPosition, SPTOrientation, SPTScale>());
+    
+    static void updateWithoutAnimators(Registry& registry, InputsGroupType& inputsGroup, TransformationHierarchy& hierarchy);
     
     using AnimatorsGroupType = decltype(Registry().group<AnimatorRecord, Transformation>());
-    static void updateWithOnlyAnimatorsChanging(Registry& registry, AnimatorsGroupType& group, const std::vector<float> animatorValues);
+    
+    // Range of the animators group sharing position coordinate system, orientation and scale models
+    struct AnimatorsPartition {
+        SPTCoordinateSystem coordinateSystem;
+        SPTOrientationModel orientationModel;
+        SPTScaleModel scaleModel;
+        std::size_t begin;
+        std::size_t end;
+    };
+    
+    // Sorts the group so that each partition is contiguous, models are not expected to change afterwards
+    static std::vector<AnimatorsPartition> partitionAnimators(AnimatorsGroupType& group);
+    
+    // Each partition is processed by a kernel specialized for its models, bound channels are read from 'boundValues'.
+    // Only objects with a flagged bound channel are recomputed, their descendants follow during propagation
+    static void updateWithOnlyAnimatorsChanging(Registry& registry, AnimatorsGroupType& group, const std::vector<AnimatorsPartition>& partitions, TransformationHierarchy& hierarchy, const std::vector<float>& boundValues, const std::vector<uint8_t>& boundValueChangeFlags);
+    
+    // Detaches roots from their parents and appends their descendants to 'entities' breadth first.
+    // Inner links are not maintained since whole subtrees are expected to be destroyed
+    static void collectSubtreesForDestroy(Registry& registry, std::vector<SPTEntity>& entities);
     
     static void onDestroy(spt::Registry& registry, SPTEntity entity);
 };
@@ -114,10 +166,12 @@ void Transformation::makeChildren(spt::Registry& registry, SPTEntity parent, It
         
         const auto entity = *it;
         
-        auto& tran = registry.emplace<Transformation>(entity);
+        // Node is linked before construction so that construction observers see the parent
+        Transformation tran;
         tran.node.parent = parent;
         tran.node.nextSibling = parentTran.node.firstChild;
         tran.node.level = parentTran.node.level + 1;
+        registry.emplace<Transformation>(entity, tran);
 
         if(parentTran.node.firstChild != kSPTNullEntity) {
             auto& firstChildTran = registry.get<Transformation>(parentTran.node.firstChild);
@@ -125,6 +179,8 @@ void Transformation::makeChildren(spt::Registry& registry, SPTEntity parent, It
         }
         
         parentTran.node.firstChild = entity;
+        
+        markDirty(registry, entity);
     }
 }
 
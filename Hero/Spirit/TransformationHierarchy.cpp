@@ -0,0 +1,263 @@
+//
+//  TransformationHierarchy.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "TransformationHierarchy.hpp"
+#include "ThreadPool.hpp"
+#include "TransformationKernels.hpp"
+
+#include <algorithm>
+
+namespace spt {
+
+void TransformationHierarchy::rebuild(Registry& registry) {
+    
+    for(auto& level: _levels) {
+        level.entities.clear();
+        level.parentIndices.clear();
+        level.locals.clear();
+        level.globals.clear();
+        level.normals.clear();
+        level.dirtyFlags.clear();
+        level.mirroringFlags.clear();
+    }
+    
+    registry.view<Transformation>().each([this] (const auto entity, Transformation& tran) {
+        if(tran.node.parent == kSPTNullEntity) {
+            append(0, entity, kNullIndex, tran);
+        }
+    });
+    
+    // Breadth first traversal so that each level is complete before the next one is visited
+    std::size_t levelCount = 0;
+    for(; levelCount < _levels.size() && !_levels[levelCount].entities.empty(); ++levelCount) {
+        for(uint32_t i = 0; i < _levels[levelCount].entities.size(); ++i) {
+            Transformation::forEachChild(registry, _levels[levelCount].entities[i], [this, levelCount, i] (auto childEntity, Transformation& childTran) {
+                append(levelCount + 1, childEntity, i, childTran);
+            });
+        }
+    }
+    _levels.resize(levelCount);
+    
+    _firstChangedLevel = 0;
+    _isValid = true;
+}
+
+void TransformationHierarchy::setLocal(const Transformation& tran, const AffineMatrix& local) {
+    assert(_isValid);
+    auto& level = _levels[tran.node.level];
+    level.locals[tran.levelIndex] = local;
+    level.dirtyFlags[tran.levelIndex] = true;
+    _firstChangedLevel = std::min(_firstChangedLevel, static_cast<std::size_t>(tran.node.level));
+}
+
+void TransformationHierarchy::propagate(Registry& registry) {
+    assert(_isValid);
+    
+    auto& threadPool = ThreadPool::active();
+    
+    for(auto levelIndex = _firstChangedLevel; levelIndex < _levels.size(); ++levelIndex) {
+        
+        const auto nodeCount = _levels[levelIndex].entities.size();
+        
+        // Nodes of the same level are independent once the previous level is done
+        if(nodeCount >= kParallelizationThreshold) {
+            threadPool.parallelFor(0, nodeCount, kParallelizationGrainSize, [this, &registry, levelIndex] (std::size_t begin, std::size_t end) {
+                propagate(registry, levelIndex, begin, end);
+            });
+        } else {
+            propagate(registry, levelIndex, 0, nodeCount);
+        }
+        
+        // Parent flags are cleared only after all children are processed
+        if(levelIndex > 0) {
+            auto& parentFlags = _levels[levelIndex - 1].dirtyFlags;
+            std::fill(parentFlags.begin(), parentFlags.end(), false);
+        }
+        
+    }
+    
+    if(!_levels.empty()) {
+        std::fill(_levels.back().dirtyFlags.begin(), _levels.back().dirtyFlags.end(), false);
+    }
+    
+    _firstChangedLevel = std::numeric_limits<std::size_t>::max();
+}
+
+void TransformationHierarchy::propagate(Registry& registry, std::size_t levelIndex, std::size_t begin, std::size_t end) {
+    
+    auto& level = _levels[levelIndex];
+    
+    GlobalMatrixBatch batch {nullptr, level.parentIndices.data(), nullptr, level.locals.data(), level.dirtyFlags.data(), level.globals.data(), level.normals.data(), level.mirroringFlags.data()};
+    if(levelIndex > 0) {
+        auto& parentLevel = _levels[levelIndex - 1];
+        batch.parentGlobals = parentLevel.globals.data();
+        batch.parentDirtyFlags = parentLevel.dirtyFlags.data();
+    }
+    computeGlobalMatrices(batch, begin, end);
+    
+    // Each node has its own component, hence publishing from multiple threads is safe
+    for(auto i = begin; i < end; ++i) {
+        if(level.dirtyFlags[i]) {
+            auto& tran = registry.get<Transformation>(level.entities[i]);
+            tran.global = level.globals[i];
+            tran.normal = level.normals[i];
+            tran.isGlobalMirroring = level.mirroringFlags[i];
+        }
+    }
+}
+
+void TransformationHierarchy::onParentChange(Registry& registry, const SPTEntity* entities, std::size_t count) {
+    if(!_isValid) {
+        return;
+    }
+    
+    _subtree.assign(entities, entities + count);
+    for(std::size_t i = 0; i < _subtree.size(); ++i) {
+        Transformation::forEachChild(registry, _subtree[i], [this] (auto childEntity, const Transformation&) {
+            _subtree.push_back(childEntity);
+        });
+    }
+    
+    // Parents are removed before children so that children still have valid
+    // level indices when a swapped node's children are fixed up
+    for(const auto subtreeEntity: _subtree) {
+        remove(registry, registry.get<Transformation>(subtreeEntity));
+    }
+    
+    // Breadth first order guarantees that parents are appended before children
+    for(const auto subtreeEntity: _subtree) {
+        auto& tran = registry.get<Transformation>(subtreeEntity);
+        if(tran.node.parent == kSPTNullEntity) {
+            append(0, subtreeEntity, kNullIndex, tran);
+        } else {
+            const auto& parentTran = registry.get<Transformation>(tran.node.parent);
+            append(parentTran.node.level + 1, subtreeEntity, parentTran.levelIndex, tran);
+        }
+    }
+    
+    trimEmptyLevels();
+}
+
+void TransformationHierarchy::onSubtreesDestroy(Registry& registry, const SPTEntity* entities, std::size_t count) {
+    if(!_isValid) {
+        return;
+    }
+    
+    for(std::size_t i = 0; i < count; ++i) {
+        remove(registry, registry.get<Transformation>(entities[i]));
+    }
+    
+    trimEmptyLevels();
+}
+
+void TransformationHierarchy::onTransformationConstruct(Registry& registry, SPTEntity entity) {
+    if(!_isValid) {
+        return;
+    }
+    
+    auto& tran = registry.get<Transformation>(entity);
+    if(tran.node.parent == kSPTNullEntity) {
+        append(0, entity, kNullIndex, tran);
+    } else {
+        const auto& parentTran = registry.get<Transformation>(tran.node.parent);
+        append(parentTran.node.level + 1, entity, parentTran.levelIndex, tran);
+    }
+}
+
+void TransformationHierarchy::onTransformationDestroy(Registry& registry, SPTEntity entity) {
+    if(!_isValid) {
+        return;
+    }
+    
+    auto& tran = registry.get<Transformation>(entity);
+    if(tran.levelIndex == kNullIndex) {
+        // Already removed along with its subtree
+        return;
+    }
+    
+    if(tran.node.childrenCount > 0) {
+        // Children are expected to be destroyed first, otherwise they are orphaned
+        invalidate();
+        return;
+    }
+    
+    remove(registry, tran);
+    trimEmptyLevels();
+}
+
+void TransformationHierarchy::append(std::size_t levelIndex, SPTEntity entity, uint32_t parentIndex, Transformation& tran) {
+    assert(levelIndex <= std::numeric_limits<decltype(tran.node.level)>::max());
+    
+    if(_levels.size() <= levelIndex) {
+        _levels.resize(levelIndex + 1);
+    }
+    
+    auto& level = _levels[levelIndex];
+    
+    tran.node.level = static_cast<decltype(tran.node.level)>(levelIndex);
+    tran.levelIndex = static_cast<uint32_t>(level.entities.size());
+    
+    level.entities.push_back(entity);
+    level.parentIndices.push_back(parentIndex);
+    level.locals.push_back(tran.local);
+    level.globals.push_back(tran.global);
+    level.normals.push_back(tran.normal);
+    level.dirtyFlags.push_back(true);
+    level.mirroringFlags.push_back(tran.isGlobalMirroring);
+    
+    _firstChangedLevel = std::min(_firstChangedLevel, levelIndex);
+}
+
+void TransformationHierarchy::remove(Registry& registry, Transformation& tran) {
+    auto& level = _levels[tran.node.level];
+    const auto index = tran.levelIndex;
+    // Reset beforehand as the node may already be linked as a child of the swapped node
+    tran.levelIndex = kNullIndex;
+    const auto lastIndex = static_cast<uint32_t>(level.entities.size() - 1);
+    
+    if(index != lastIndex) {
+        const auto lastEntity = level.entities[lastIndex];
+        
+        level.entities[index] = lastEntity;
+        level.parentIndices[index] = level.parentIndices[lastIndex];
+        level.locals[index] = level.locals[lastIndex];
+        level.globals[index] = level.globals[lastIndex];
+        level.normals[index] = level.normals[lastIndex];
+        level.dirtyFlags[index] = level.dirtyFlags[lastIndex];
+        level.mirroringFlags[index] = level.mirroringFlags[lastIndex];
+        
+        registry.get<Transformation>(lastEntity).levelIndex = index;
+        
+        // Already removed children have null level index, children that are relinked
+        // but not moved yet are still in their former level
+        if(tran.node.level + 1u < _levels.size()) {
+            const auto childLevelIndex = tran.node.level + 1u;
+            auto& childLevel = _levels[childLevelIndex];
+            Transformation::forEachChild(registry, lastEntity, [&childLevel, childLevelIndex, index] (auto, const Transformation& childTran) {
+                if(childTran.levelIndex != kNullIndex && childTran.node.level == childLevelIndex) {
+                    childLevel.parentIndices[childTran.levelIndex] = index;
+                }
+            });
+        }
+    }
+    
+    level.entities.pop_back();
+    level.parentIndices.pop_back();
+    level.locals.pop_back();
+    level.globals.pop_back();
+    level.normals.pop_back();
+    level.dirtyFlags.pop_back();
+    level.mirroringFlags.pop_back();
+}
+
+void TransformationHierarchy::trimEmptyLevels() {
+    while(!_levels.empty() && _levels.back().entities.empty()) {
+        _levels.pop_back();
+    }
+}
+
+}
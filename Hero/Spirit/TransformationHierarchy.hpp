@@ -0,0 +1,92 @@
+//
+//  TransformationHierarchy.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "Base.hpp"
+#include "Transformation.hpp"
+#include "AffineMatrix.hpp"
+
+#include <simd/simd.h>
+#include <vector>
+#include <limits>
+
+namespace spt {
+
+// Transformation nodes laid out level by level in contiguous arrays.
+// Every node's parent is located in the previous level, hence global matrices
+// are propagated with linear passes without chasing node links through the registry.
+// Levels are maintained incrementally as nodes are created, destroyed and reparented
+class TransformationHierarchy {
+public:
+    
+    static constexpr uint32_t kNullIndex = std::numeric_limits<uint32_t>::max();
+    
+    // Levels with fewer nodes are processed on the calling thread
+    static constexpr std::size_t kParallelizationThreshold = 8192;
+    static constexpr std::size_t kParallelizationGrainSize = 2048;
+    
+    struct Level {
+        std::vector<SPTEntity> entities;
+        // Indices in the previous level
+        std::vector<uint32_t> parentIndices;
+        std::vector<AffineMatrix> locals;
+        std::vector<AffineMatrix> globals;
+        std::vector<AffineMatrix> normals;
+        // Set for nodes whose global matrix must be recomputed, pushed down to children during propagation
+        std::vector<uint8_t> dirtyFlags;
+        std::vector<uint8_t> mirroringFlags;
+    };
+    
+    void invalidate() { _isValid = false; }
+    
+    bool isValid() const { return _isValid; }
+    
+    // Lays out nodes starting from roots following 'Transformation' node links.
+    // Updates node levels and level indices of 'Transformation' components
+    void rebuild(Registry& registry);
+    
+    // Moves the subtree of the node under its new parent, must be called after node links are updated
+    void onParentChange(Registry& registry, SPTEntity entity) { onParentChange(registry, &entity, 1); }
+    
+    // Moves subtrees of all nodes in a single pass, none of the nodes may be a descendant of another one
+    void onParentChange(Registry& registry, const SPTEntity* entities, std::size_t count);
+    
+    void setLocal(const Transformation& tran, const AffineMatrix& local);
+    
+    // Recomputes global matrices of nodes with a changed local matrix and their descendants
+    // and publishes them to 'Transformation' components. Each global matrix is computed at most once.
+    // Large levels are split over 'ThreadPool'
+    void propagate(Registry& registry);
+    
+    const std::vector<Level>& levels() const { return _levels; }
+    
+    // Removes nodes ahead of their destruction, parents must precede children
+    void onSubtreesDestroy(Registry& registry, const SPTEntity* entities, std::size_t count);
+    
+    void onTransformationConstruct(Registry& registry, SPTEntity entity);
+    void onTransformationDestroy(Registry& registry, SPTEntity entity);
+
+private:
+    
+    void propagate(Registry& registry, std::size_t levelIndex, std::size_t begin, std::size_t end);
+    
+    void append(std::size_t levelIndex, SPTEntity entity, uint32_t parentIndex, Transformation& tran);
+    
+    // Swaps the node with the last one in its level and pops it
+    void remove(Registry& registry, Transformation& tran);
+    
+    void trimEmptyLevels();
+    
+    std::vector<Level> _levels;
+    // Reused buffer for subtree traversals
+    std::vector<SPTEntity> _subtree;
+    std::size_t _firstChangedLevel { 0 };
+    bool _isValid { true };
+};
+
+}
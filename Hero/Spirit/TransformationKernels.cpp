@@ -0,0 +1,116 @@
+//
+//  TransformationKernels.cpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#include "TransformationKernels.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace spt {
+
+namespace {
+
+// Matrices are row major 3x4, row 'i' starts at float offset 4 * i
+inline void multiply(const float* lhs, const float* rhs, float* result) {
+#if defined(__AVX2__) && defined(__FMA__)
+    const auto rhs0 = _mm_loadu_ps(rhs);
+    const auto rhs1 = _mm_loadu_ps(rhs + 4);
+    const auto rhs2 = _mm_loadu_ps(rhs + 8);
+    // Implicit last row of 'rhs', picks 'lhs' translation
+    const auto rhs3 = _mm_set_ps(1.f, 0.f, 0.f, 0.f);
+    
+    for(int row = 0; row < 3; ++row) {
+        const auto lhsRow = lhs + 4 * row;
+        auto resultRow = _mm_mul_ps(_mm_broadcast_ss(lhsRow), rhs0);
+        resultRow = _mm_fmadd_ps(_mm_broadcast_ss(lhsRow + 1), rhs1, resultRow);
+        resultRow = _mm_fmadd_ps(_mm_broadcast_ss(lhsRow + 2), rhs2, resultRow);
+        resultRow = _mm_fmadd_ps(_mm_broadcast_ss(lhsRow + 3), rhs3, resultRow);
+        _mm_storeu_ps(result + 4 * row, resultRow);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const auto rhs0 = vld1q_f32(rhs);
+    const auto rhs1 = vld1q_f32(rhs + 4);
+    const auto rhs2 = vld1q_f32(rhs + 8);
+    // Implicit last row of 'rhs', picks 'lhs' translation
+    const float32x4_t rhs3 = {0.f, 0.f, 0.f, 1.f};
+    
+    for(int row = 0; row < 3; ++row) {
+        const auto lhsRow = vld1q_f32(lhs + 4 * row);
+        auto resultRow = vmulq_laneq_f32(rhs0, lhsRow, 0);
+        resultRow = vfmaq_laneq_f32(resultRow, rhs1, lhsRow, 1);
+        resultRow = vfmaq_laneq_f32(resultRow, rhs2, lhsRow, 2);
+        resultRow = vfmaq_laneq_f32(resultRow, rhs3, lhsRow, 3);
+        vst1q_f32(result + 4 * row, resultRow);
+    }
+#else
+    for(int row = 0; row < 3; ++row) {
+        const auto lhsRow = lhs + 4 * row;
+        for(int column = 0; column < 4; ++column) {
+            result[4 * row + column] = lhsRow[0] * rhs[column] + lhsRow[1] * rhs[4 + column] + lhsRow[2] * rhs[8 + column];
+        }
+        result[4 * row + 3] += lhsRow[3];
+    }
+#endif
+}
+
+// Normal matrix is the transposed inverse of the upper left 3x3 which equals to
+// '[cross(r1, r2); cross(r2, r0); cross(r0, r1)] / det' where 'det = dot(r0, cross(r1, r2))'.
+// Translation is dropped as normals are transformed with zero 'w'
+inline bool computeNormal(const float* matrix, float* normal) {
+    const auto r0 = matrix;
+    const auto r1 = matrix + 4;
+    const auto r2 = matrix + 8;
+    
+    const float cofactors[3][3] = {
+        {r1[1] * r2[2] - r1[2] * r2[1], r1[2] * r2[0] - r1[0] * r2[2], r1[0] * r2[1] - r1[1] * r2[0]},
+        {r2[1] * r0[2] - r2[2] * r0[1], r2[2] * r0[0] - r2[0] * r0[2], r2[0] * r0[1] - r2[1] * r0[0]},
+        {r0[1] * r1[2] - r0[2] * r1[1], r0[2] * r1[0] - r0[0] * r1[2], r0[0] * r1[1] - r0[1] * r1[0]}
+    };
+    
+    const auto determinant = r0[0] * cofactors[0][0] + r0[1] * cofactors[0][1] + r0[2] * cofactors[0][2];
+    const auto inverseDeterminant = 1.f / determinant;
+    
+    for(int row = 0; row < 3; ++row) {
+        normal[4 * row] = cofactors[row][0] * inverseDeterminant;
+        normal[4 * row + 1] = cofactors[row][1] * inverseDeterminant;
+        normal[4 * row + 2] = cofactors[row][2] * inverseDeterminant;
+        normal[4 * row + 3] = 0.f;
+    }
+    
+    // Mirroring flag
+    return determinant < 0.f;
+}
+
+}
+
+void computeGlobalMatrices(const GlobalMatrixBatch& batch, std::size_t begin, std::size_t end) {
+    
+    if(!batch.parentGlobals) {
+        for(auto i = begin; i < end; ++i) {
+            if(batch.dirtyFlags[i]) {
+                batch.globals[i] = batch.locals[i];
+                batch.mirroringFlags[i] = computeNormal(reinterpret_cast<const float*>(batch.globals + i), reinterpret_cast<float*>(batch.normals + i));
+            }
+        }
+        return;
+    }
+    
+    for(auto i = begin; i < end; ++i) {
+        const auto parentIndex = batch.parentIndices[i];
+        batch.dirtyFlags[i] |= batch.parentDirtyFlags[parentIndex];
+        if(batch.dirtyFlags[i]) {
+            const auto global = reinterpret_cast<float*>(batch.globals + i);
+            multiply(reinterpret_cast<const float*>(batch.parentGlobals + parentIndex), reinterpret_cast<const float*>(batch.locals + i), global);
+            batch.mirroringFlags[i] = computeNormal(global, reinterpret_cast<float*>(batch.normals + i));
+        }
+    }
+}
+
+}
@@ -0,0 +1,35 @@
+//
+//  TransformationKernels.hpp
+//  Hero
+//
+//  Created by Vanush Grigoryan on 18.10.26.
+//
+
+#pragma once
+
+#include "AffineMatrix.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace spt {
+
+// Arrays of a single hierarchy level, parent arrays belong to the previous level
+struct GlobalMatrixBatch {
+    // Null for the root level
+    const AffineMatrix* parentGlobals;
+    const uint32_t* parentIndices;
+    const uint8_t* parentDirtyFlags;
+    const AffineMatrix* locals;
+    uint8_t* dirtyFlags;
+    AffineMatrix* globals;
+    AffineMatrix* normals;
+    uint8_t* mirroringFlags;
+};
+
+// For each node in [begin, end) inherits parent dirty flag and if dirty computes
+// 'globals[i] = parentGlobals[parentIndices[i]] * locals[i]' along with the sign
+// of the upper left 3x3 determinant and the normal matrix in the same pass
+void computeGlobalMatrices(const GlobalMatrixBatch& batch, std::size_t begin, std::size_t end);
+
+}